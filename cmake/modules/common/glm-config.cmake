@@ -10,7 +10,7 @@ if(NOT TARGET glm)
     FetchContent_MakeAvailable(glm)
 
     add_library(glm INTERFACE)
-    target_include_directories(stb INTERFACE 
+    target_include_directories(glm INTERFACE 
         "${glm_SOURCE_DIR}"
     )
     
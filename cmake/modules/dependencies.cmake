@@ -39,4 +39,5 @@ add_dependency("glad" "glad" "glad")
 add_dependency("stb" "stb" "stb")
 add_dependency("dejavu" "dejavu-fonts" "dejavu")
 add_dependency("glm" "glm" "glm")
+find_package(Threads REQUIRED)
 # add_dependency("Catch2::Catch2WithMain" "Catch2" "Catch2")
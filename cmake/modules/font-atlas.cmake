@@ -0,0 +1,33 @@
+message("Configure font atlas task")
+
+# Host tool that rasterises the font atlas at build time, built natively unless cross-compiling.
+# When cross-compiling, point FONT_BAKER_EXECUTABLE to a build of AntColonyFontBaker that runs on the host.
+set(FONT_BAKER_EXECUTABLE "" CACHE FILEPATH "Prebuilt host AntColonyFontBaker, required when cross-compiling")
+
+if(FONT_BAKER_EXECUTABLE)
+    set(FONT_BAKER_COMMAND "${FONT_BAKER_EXECUTABLE}")
+elseif(CMAKE_CROSSCOMPILING)
+    message(FATAL_ERROR "Cross-compiling requires FONT_BAKER_EXECUTABLE to be set to a host build of AntColonyFontBaker.")
+else()
+    add_executable(AntColonyFontBaker "tools/fontBaker/fontBaker.cpp")
+    target_link_libraries(
+        AntColonyFontBaker
+        PRIVATE
+        stb
+        dejavu
+    )
+    set(FONT_BAKER_COMMAND AntColonyFontBaker)
+endif()
+
+set(FONT_ATLAS_SOURCE "${CMAKE_CURRENT_BINARY_DIR}/generated/fontAtlasData.cpp")
+
+add_custom_command(
+    OUTPUT "${FONT_ATLAS_SOURCE}"
+    COMMAND ${CMAKE_COMMAND} -E make_directory "${CMAKE_CURRENT_BINARY_DIR}/generated"
+    COMMAND ${FONT_BAKER_COMMAND} "${FONT_ATLAS_SOURCE}"
+    DEPENDS ${FONT_BAKER_COMMAND}
+    COMMENT "Baking font atlas"
+    VERBATIM
+)
+
+message("Font atlas configuration done")
@@ -19,6 +19,7 @@ target_sources(
     ${RENDER_SOURCES}
     ${SIMULATION_SOURCES}
     ${UTILS_SOURCES}
+    ${FONT_ATLAS_SOURCE}
 )
 
 target_link_libraries(
@@ -27,8 +28,8 @@ target_link_libraries(
     glfw
     glad
     OpenGL::GL
-    stb
-    dejavu
+    glm
+    Threads::Threads
 )
 
 target_include_directories(
@@ -37,4 +38,13 @@ target_include_directories(
     ${CMAKE_CURRENT_SOURCE_DIR}/src
 )
 
+# The batched pheromone math must round like the scalar one, so multiply-adds may not be fused into FMA
+# (GCC fuses by default on aarch64 and with -march=native). PUBLIC so tests and tools inlining vec2Batch.hpp match.
+# MSVC does not contract without /fp:contract.
+target_compile_options(
+    AntColonySimLib
+    PUBLIC
+    $<$<CXX_COMPILER_ID:GNU,Clang,AppleClang>:-ffp-contract=off>
+)
+
 message("Lib configuration done")
\ No newline at end of file
@@ -0,0 +1,14 @@
+message("Configure render benchmark task")
+add_executable(
+    AntColonyRenderBenchmark
+    "tools/renderBenchmark/renderBenchmark.cpp"
+    "tools/renderBenchmark/sceneRecorder.cpp"
+)
+target_link_libraries(
+    AntColonyRenderBenchmark
+    PRIVATE
+    AntColonySimLib
+    glfw
+    glad
+)
+message("Render benchmark configuration done")
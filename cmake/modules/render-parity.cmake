@@ -0,0 +1,14 @@
+message("Configure render parity task")
+add_executable(
+    AntColonyRenderParity
+    "tools/renderParity/renderParity.cpp"
+    "tools/renderBenchmark/sceneRecorder.cpp"
+)
+target_link_libraries(
+    AntColonyRenderParity
+    PRIVATE
+    AntColonySimLib
+    glfw
+    glad
+)
+message("Render parity configuration done")
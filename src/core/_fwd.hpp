@@ -2,6 +2,15 @@ namespace AntColony::Core
 {
     class Logger;
     struct Color;
-    struct Point;
+    struct Vec2;
+    using Point = Vec2;
+    struct Floatx4;
+    struct Floatx8;
+    template <typename Lanes>
+    struct Vec2Batch;
+    using Vec2x4 = Vec2Batch<Floatx4>;
+    using Vec2x8 = Vec2Batch<Floatx8>;
+    struct DensityGrid;
+    class LooseGrid;
     struct ViewPort;
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "densityGrid.hpp"
+#include "point.hpp"
+
+#include <algorithm>
+
+namespace AntColony::Core
+{
+    DensityGrid::DensityGrid(ViewPort area, int width, int height)
+        : area(area), width(width), height(height), cells(static_cast<size_t>(width) * height, 0.0f), maxValue(0.0f) {}
+
+    void DensityGrid::clear()
+    {
+        std::fill(cells.begin(), cells.end(), 0.0f);
+        maxValue = 0.0f;
+    }
+
+    void DensityGrid::accumulate(const Point &position, float value)
+    {
+        if (!area.checkViewportBoundaries(position))
+            return;
+
+        const auto cellX = static_cast<int>((position.x - area.minX) / (area.maxX - area.minX) * width);
+        const auto cellY = static_cast<int>((position.y - area.minY) / (area.maxY - area.minY) * height);
+
+        auto &cell = cells[std::min(cellY, height - 1) * width + std::min(cellX, width - 1)];
+        cell += value;
+        maxValue = std::max(maxValue, cell);
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "_fwd.hpp"
+#include "viewPort.hpp"
+
+#include <vector>
+
+namespace AntColony::Core
+{
+    /**
+     * @brief Low-resolution accumulation buffer over a rectangular area, row 0 is at area.minY.
+     */
+    struct DensityGrid
+    {
+        DensityGrid(ViewPort area, int width, int height);
+
+        ViewPort area;
+        int width;
+        int height;
+        std::vector<float> cells;
+
+        /// @brief Largest accumulated cell value since the last clear.
+        float maxValue;
+
+        void clear();
+        void accumulate(const Point &position, float value);
+    };
+}
@@ -0,0 +1,40 @@
+#include "looseGrid.hpp"
+
+namespace AntColony::Core
+{
+    LooseGrid::LooseGrid(ViewPort area, int width, int height)
+        : area(area),
+          width(std::max(1, width)),
+          height(std::max(1, height)),
+          cells(static_cast<size_t>(std::max(1, width)) * std::max(1, height)),
+          maxRadius(0.0f) {}
+
+    void LooseGrid::insert(std::uint32_t id, const Point &center, float radius)
+    {
+        if (id >= cellOfId.size())
+            cellOfId.resize(id + 1, -1);
+        else if (cellOfId[id] >= 0)
+            remove(id);
+
+        const auto cell = cellY(center.y) * width + cellX(center.x);
+        cells[cell].push_back(id);
+        cellOfId[id] = cell;
+        maxRadius = std::max(maxRadius, radius);
+    }
+
+    void LooseGrid::remove(std::uint32_t id)
+    {
+        if (id >= cellOfId.size() || cellOfId[id] < 0)
+            return;
+
+        auto &cell = cells[cellOfId[id]];
+        const auto it = std::find(cell.begin(), cell.end(), id);
+        if (it != cell.end())
+        {
+            *it = cell.back();
+            cell.pop_back();
+        }
+
+        cellOfId[id] = -1;
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "_fwd.hpp"
+#include "point.hpp"
+#include "viewPort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace AntColony::Core
+{
+    /**
+     * @brief Uniform grid of circles with varying radii, each stored once in the cell holding its center.
+     *
+     * Cells are loose: a query widens its range by the largest radius ever inserted, so circles may shrink
+     * in place without being reinserted. Ids index an internal table and should be small and dense, e.g. slots.
+     */
+    class LooseGrid
+    {
+    public:
+        LooseGrid(ViewPort area, int width, int height);
+
+        /**
+         * @brief Adds a circle, centers outside the area go to the nearest border cell.
+         */
+        void insert(std::uint32_t id, const Point &center, float radius);
+
+        void remove(std::uint32_t id);
+
+        /**
+         * @brief Calls visit(id) for every circle that may overlap the given one, candidates need an exact check.
+         */
+        template <typename Visitor>
+        void forEachNear(const Point &center, float radius, Visitor &&visit) const
+        {
+            const auto range = radius + maxRadius;
+            const auto minCellX = cellX(center.x - range);
+            const auto maxCellX = cellX(center.x + range);
+            const auto minCellY = cellY(center.y - range);
+            const auto maxCellY = cellY(center.y + range);
+
+            for (auto y = minCellY; y <= maxCellY; y++)
+            {
+                for (auto x = minCellX; x <= maxCellX; x++)
+                {
+                    for (const auto id : cells[y * width + x])
+                        visit(id);
+                }
+            }
+        }
+
+        /**
+         * @brief Calls visit(id) for every circle that may overlap the rectangle, candidates need an exact check.
+         */
+        template <typename Visitor>
+        void forEachInArea(const ViewPort &region, Visitor &&visit) const
+        {
+            const auto minCellX = cellX(region.minX - maxRadius);
+            const auto maxCellX = cellX(region.maxX + maxRadius);
+            const auto minCellY = cellY(region.minY - maxRadius);
+            const auto maxCellY = cellY(region.maxY + maxRadius);
+
+            for (auto y = minCellY; y <= maxCellY; y++)
+            {
+                for (auto x = minCellX; x <= maxCellX; x++)
+                {
+                    for (const auto id : cells[y * width + x])
+                        visit(id);
+                }
+            }
+        }
+
+    private:
+        ViewPort area;
+        int width;
+        int height;
+        /// @brief Ids per cell, row 0 is at area.minY.
+        std::vector<std::vector<std::uint32_t>> cells;
+        /// @brief Cell of each inserted id, -1 if absent.
+        std::vector<int> cellOfId;
+        /// @brief Largest radius inserted so far, only grows.
+        float maxRadius;
+
+        int cellX(float x) const
+        {
+            return std::clamp(static_cast<int>((x - area.minX) / (area.maxX - area.minX) * width), 0, width - 1);
+        }
+
+        int cellY(float y) const
+        {
+            return std::clamp(static_cast<int>((y - area.minY) / (area.maxY - area.minY) * height), 0, height - 1);
+        }
+    };
+}
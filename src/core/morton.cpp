@@ -0,0 +1,40 @@
+#include "morton.hpp"
+#include "point.hpp"
+#include "viewPort.hpp"
+
+#include <algorithm>
+
+namespace AntColony::Core
+{
+    // Cells per axis, the largest value fitting 16 bits
+    constexpr const float MORTON_RESOLUTION = 65535.0f;
+
+    namespace
+    {
+        /**
+         * @brief Moves the low 16 bits to the even bit positions
+         */
+        std::uint32_t spreadBits(std::uint32_t value)
+        {
+            value &= 0x0000ffff;
+            value = (value | (value << 8)) & 0x00ff00ff;
+            value = (value | (value << 4)) & 0x0f0f0f0f;
+            value = (value | (value << 2)) & 0x33333333;
+            value = (value | (value << 1)) & 0x55555555;
+            return value;
+        }
+
+        std::uint32_t quantize(float value, float min, float max)
+        {
+            const auto normalized = max > min ? (value - min) / (max - min) : 0.0f;
+            return static_cast<std::uint32_t>(std::clamp(normalized, 0.0f, 1.0f) * MORTON_RESOLUTION);
+        }
+    }
+
+    std::uint32_t mortonKey(const Point &position, const ViewPort &area)
+    {
+        const auto x = quantize(position.x, area.minX, area.maxX);
+        const auto y = quantize(position.y, area.minY, area.maxY);
+        return spreadBits(x) | (spreadBits(y) << 1);
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "_fwd.hpp"
+
+#include <cstdint>
+
+namespace AntColony::Core
+{
+    /**
+     * @brief Z-order key of a position, 16 bits per axis over the area interleaved.
+     *
+     * Positions close in space mostly get close keys, sorting by them groups neighbours in memory.
+     * Positions outside the area are clamped to its border.
+     */
+    std::uint32_t mortonKey(const Point &position, const ViewPort &area);
+}
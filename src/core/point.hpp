@@ -1,21 +1,9 @@
 #pragma once
 
-#include <cmath>
+#include "vec2.hpp"
 
 namespace AntColony::Core
 {
-    struct Point
-    {
-        float x, y;
-
-        Point();
-        Point(float x, float y);
-
-        Point operator+(const Point &other) const;
-        Point operator*(const float scalar) const;
-        Point operator-(const Point &other) const;
-        Point &operator+=(const Point &other);
-        Point &operator*=(const float scalar);
-        float distanceTo(const Point &other) const;
-    };
-}
\ No newline at end of file
+    /// @brief Positions, velocities and sizes in world space.
+    using Point = Vec2;
+}
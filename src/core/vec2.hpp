@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cmath>
+
+namespace AntColony::Core
+{
+    /**
+     * @brief 2D float vector with inline constexpr arithmetic.
+     *
+     * Defined in the header so the simulation loops can inline and vectorise it. Trivially default-constructible,
+     * Vec2 v; leaves the components uninitialised, Vec2 v{}; zeroes them.
+     */
+    struct Vec2
+    {
+        float x, y;
+
+        Vec2() = default;
+        constexpr Vec2(float x, float y) : x(x), y(y) {}
+
+        constexpr Vec2 operator+(const Vec2 &other) const { return {x + other.x, y + other.y}; }
+        constexpr Vec2 operator-(const Vec2 &other) const { return {x - other.x, y - other.y}; }
+        constexpr Vec2 operator*(const float scalar) const { return {x * scalar, y * scalar}; }
+
+        constexpr Vec2 &operator+=(const Vec2 &other)
+        {
+            x += other.x;
+            y += other.y;
+            return *this;
+        }
+
+        constexpr Vec2 &operator*=(const float scalar)
+        {
+            x *= scalar;
+            y *= scalar;
+            return *this;
+        }
+
+        constexpr float dot(const Vec2 &other) const { return x * other.x + y * other.y; }
+        constexpr float lengthSquared() const { return x * x + y * y; }
+
+        /**
+         * @brief Squared distance, compare it with a squared radius to skip the square root
+         */
+        constexpr float distanceSquaredTo(const Vec2 &other) const
+        {
+            const auto dx = x - other.x;
+            const auto dy = y - other.y;
+            return dx * dx + dy * dy;
+        }
+
+        float length() const { return std::sqrt(lengthSquared()); }
+        float distanceTo(const Vec2 &other) const { return std::sqrt(distanceSquaredTo(other)); }
+    };
+}
@@ -0,0 +1,220 @@
+#pragma once
+#include "_fwd.hpp"
+
+#include "vec2.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ANT_COLONY_SIMD_SSE
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define ANT_COLONY_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(ANT_COLONY_SIMD_SSE) && defined(__AVX__)
+#define ANT_COLONY_SIMD_AVX
+#endif
+
+namespace AntColony::Core
+{
+    /**
+     * @brief Four float lanes over SSE or NEON, plain arrays elsewhere.
+     *
+     * Every operation rounds like its scalar counterpart, min and max pick lanes like std::min and std::max,
+     * so a batched loop gives the same results as the scalar one as long as the compiler does not fuse multiply-adds
+     * (the build passes -ffp-contract=off).
+     */
+    struct Floatx4
+    {
+#if defined(ANT_COLONY_SIMD_SSE)
+        __m128 v;
+
+        Floatx4() = default;
+        explicit Floatx4(__m128 v) : v(v) {}
+        explicit Floatx4(float value) : v(_mm_set1_ps(value)) {}
+
+        static Floatx4 load(const float *values) { return Floatx4(_mm_loadu_ps(values)); }
+        void store(float *values) const { _mm_storeu_ps(values, v); }
+
+        Floatx4 operator+(Floatx4 other) const { return Floatx4(_mm_add_ps(v, other.v)); }
+        Floatx4 operator-(Floatx4 other) const { return Floatx4(_mm_sub_ps(v, other.v)); }
+        Floatx4 operator*(Floatx4 other) const { return Floatx4(_mm_mul_ps(v, other.v)); }
+        Floatx4 operator/(Floatx4 other) const { return Floatx4(_mm_div_ps(v, other.v)); }
+
+        friend Floatx4 sqrt(Floatx4 a) { return Floatx4(_mm_sqrt_ps(a.v)); }
+        // _mm_min_ps(a, b) is a < b ? a : b, std::min(a, b) is b < a ? b : a
+        friend Floatx4 min(Floatx4 a, Floatx4 b) { return Floatx4(_mm_min_ps(b.v, a.v)); }
+        friend Floatx4 max(Floatx4 a, Floatx4 b) { return Floatx4(_mm_max_ps(b.v, a.v)); }
+
+        /**
+         * @brief Lane-wise a > b ? ifTrue : ifFalse
+         */
+        friend Floatx4 selectGreater(Floatx4 a, Floatx4 b, Floatx4 ifTrue, Floatx4 ifFalse)
+        {
+            const auto mask = _mm_cmpgt_ps(a.v, b.v);
+            return Floatx4(_mm_or_ps(_mm_and_ps(mask, ifTrue.v), _mm_andnot_ps(mask, ifFalse.v)));
+        }
+#elif defined(ANT_COLONY_SIMD_NEON)
+        float32x4_t v;
+
+        Floatx4() = default;
+        explicit Floatx4(float32x4_t v) : v(v) {}
+        explicit Floatx4(float value) : v(vdupq_n_f32(value)) {}
+
+        static Floatx4 load(const float *values) { return Floatx4(vld1q_f32(values)); }
+        void store(float *values) const { vst1q_f32(values, v); }
+
+        Floatx4 operator+(Floatx4 other) const { return Floatx4(vaddq_f32(v, other.v)); }
+        Floatx4 operator-(Floatx4 other) const { return Floatx4(vsubq_f32(v, other.v)); }
+        Floatx4 operator*(Floatx4 other) const { return Floatx4(vmulq_f32(v, other.v)); }
+        Floatx4 operator/(Floatx4 other) const { return Floatx4(vdivq_f32(v, other.v)); }
+
+        friend Floatx4 sqrt(Floatx4 a) { return Floatx4(vsqrtq_f32(a.v)); }
+        // vminq_f32 and vmaxq_f32 propagate NaN, compare and select to match std::min and std::max
+        friend Floatx4 min(Floatx4 a, Floatx4 b) { return Floatx4(vbslq_f32(vcltq_f32(b.v, a.v), b.v, a.v)); }
+        friend Floatx4 max(Floatx4 a, Floatx4 b) { return Floatx4(vbslq_f32(vcltq_f32(a.v, b.v), b.v, a.v)); }
+
+        /**
+         * @brief Lane-wise a > b ? ifTrue : ifFalse
+         */
+        friend Floatx4 selectGreater(Floatx4 a, Floatx4 b, Floatx4 ifTrue, Floatx4 ifFalse)
+        {
+            return Floatx4(vbslq_f32(vcgtq_f32(a.v, b.v), ifTrue.v, ifFalse.v));
+        }
+#else
+        float v[4];
+
+        Floatx4() = default;
+        explicit Floatx4(float value) : v{value, value, value, value} {}
+
+        static Floatx4 load(const float *values) { return map([&](int i) { return values[i]; }); }
+        void store(float *values) const { std::copy(v, v + 4, values); }
+
+        Floatx4 operator+(Floatx4 other) const { return map([&](int i) { return v[i] + other.v[i]; }); }
+        Floatx4 operator-(Floatx4 other) const { return map([&](int i) { return v[i] - other.v[i]; }); }
+        Floatx4 operator*(Floatx4 other) const { return map([&](int i) { return v[i] * other.v[i]; }); }
+        Floatx4 operator/(Floatx4 other) const { return map([&](int i) { return v[i] / other.v[i]; }); }
+
+        friend Floatx4 sqrt(Floatx4 a) { return map([&](int i) { return std::sqrt(a.v[i]); }); }
+        friend Floatx4 min(Floatx4 a, Floatx4 b) { return map([&](int i) { return std::min(a.v[i], b.v[i]); }); }
+        friend Floatx4 max(Floatx4 a, Floatx4 b) { return map([&](int i) { return std::max(a.v[i], b.v[i]); }); }
+
+        /**
+         * @brief Lane-wise a > b ? ifTrue : ifFalse
+         */
+        friend Floatx4 selectGreater(Floatx4 a, Floatx4 b, Floatx4 ifTrue, Floatx4 ifFalse)
+        {
+            return map([&](int i) { return a.v[i] > b.v[i] ? ifTrue.v[i] : ifFalse.v[i]; });
+        }
+
+    private:
+        template <typename Lane>
+        static Floatx4 map(Lane lane)
+        {
+            Floatx4 result;
+            for (auto i = 0; i < 4; i++)
+                result.v[i] = lane(i);
+            return result;
+        }
+#endif
+    };
+
+    /**
+     * @brief Eight float lanes over AVX, two Floatx4 halves elsewhere. Same rounding guarantees as Floatx4.
+     */
+    struct Floatx8
+    {
+#if defined(ANT_COLONY_SIMD_AVX)
+        __m256 v;
+
+        Floatx8() = default;
+        explicit Floatx8(__m256 v) : v(v) {}
+        explicit Floatx8(float value) : v(_mm256_set1_ps(value)) {}
+
+        static Floatx8 load(const float *values) { return Floatx8(_mm256_loadu_ps(values)); }
+        void store(float *values) const { _mm256_storeu_ps(values, v); }
+
+        Floatx8 operator+(Floatx8 other) const { return Floatx8(_mm256_add_ps(v, other.v)); }
+        Floatx8 operator-(Floatx8 other) const { return Floatx8(_mm256_sub_ps(v, other.v)); }
+        Floatx8 operator*(Floatx8 other) const { return Floatx8(_mm256_mul_ps(v, other.v)); }
+        Floatx8 operator/(Floatx8 other) const { return Floatx8(_mm256_div_ps(v, other.v)); }
+
+        friend Floatx8 sqrt(Floatx8 a) { return Floatx8(_mm256_sqrt_ps(a.v)); }
+        friend Floatx8 min(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_min_ps(b.v, a.v)); }
+        friend Floatx8 max(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_max_ps(b.v, a.v)); }
+
+        friend Floatx8 selectGreater(Floatx8 a, Floatx8 b, Floatx8 ifTrue, Floatx8 ifFalse)
+        {
+            return Floatx8(_mm256_blendv_ps(ifFalse.v, ifTrue.v, _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)));
+        }
+#else
+        Floatx4 low;
+        Floatx4 high;
+
+        Floatx8() = default;
+        Floatx8(Floatx4 low, Floatx4 high) : low(low), high(high) {}
+        explicit Floatx8(float value) : low(value), high(value) {}
+
+        static Floatx8 load(const float *values) { return {Floatx4::load(values), Floatx4::load(values + 4)}; }
+
+        void store(float *values) const
+        {
+            low.store(values);
+            high.store(values + 4);
+        }
+
+        Floatx8 operator+(Floatx8 other) const { return {low + other.low, high + other.high}; }
+        Floatx8 operator-(Floatx8 other) const { return {low - other.low, high - other.high}; }
+        Floatx8 operator*(Floatx8 other) const { return {low * other.low, high * other.high}; }
+        Floatx8 operator/(Floatx8 other) const { return {low / other.low, high / other.high}; }
+
+        friend Floatx8 sqrt(Floatx8 a) { return {sqrt(a.low), sqrt(a.high)}; }
+        friend Floatx8 min(Floatx8 a, Floatx8 b) { return {min(a.low, b.low), min(a.high, b.high)}; }
+        friend Floatx8 max(Floatx8 a, Floatx8 b) { return {max(a.low, b.low), max(a.high, b.high)}; }
+
+        friend Floatx8 selectGreater(Floatx8 a, Floatx8 b, Floatx8 ifTrue, Floatx8 ifFalse)
+        {
+            return {selectGreater(a.low, b.low, ifTrue.low, ifFalse.low), selectGreater(a.high, b.high, ifTrue.high, ifFalse.high)};
+        }
+#endif
+    };
+
+    /**
+     * @brief Batch of 2D vectors stored as coordinate lanes, the batched counterpart of Vec2.
+     */
+    template <typename Lanes>
+    struct Vec2Batch
+    {
+        Lanes x;
+        Lanes y;
+
+        Vec2Batch() = default;
+        Vec2Batch(Lanes x, Lanes y) : x(x), y(y) {}
+        explicit Vec2Batch(const Vec2 &value) : x(value.x), y(value.y) {}
+
+        /**
+         * @brief Loads consecutive vectors from separate x and y arrays
+         */
+        static Vec2Batch load(const float *xs, const float *ys) { return {Lanes::load(xs), Lanes::load(ys)}; }
+
+        void store(float *xs, float *ys) const
+        {
+            x.store(xs);
+            y.store(ys);
+        }
+
+        Vec2Batch operator+(const Vec2Batch &other) const { return {x + other.x, y + other.y}; }
+        Vec2Batch operator-(const Vec2Batch &other) const { return {x - other.x, y - other.y}; }
+        Vec2Batch operator*(Lanes scalar) const { return {x * scalar, y * scalar}; }
+
+        Lanes dot(const Vec2Batch &other) const { return x * other.x + y * other.y; }
+        Lanes lengthSquared() const { return x * x + y * y; }
+        Lanes length() const { return sqrt(lengthSquared()); }
+    };
+
+    using Vec2x4 = Vec2Batch<Floatx4>;
+    using Vec2x8 = Vec2Batch<Floatx8>;
+}
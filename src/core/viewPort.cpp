@@ -10,4 +10,9 @@ namespace AntColony::Core
     {
         return minX < position.x && position.x < maxX && minY < position.y && position.y < maxY;
     }
+
+    bool ViewPort::overlapsCircle(const Point &center, float radius) const
+    {
+        return center.x + radius >= minX && center.x - radius <= maxX && center.y + radius >= minY && center.y - radius <= maxY;
+    }
 }
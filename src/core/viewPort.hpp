@@ -13,5 +13,10 @@ namespace AntColony::Core
         float maxY;
 
         bool checkViewportBoundaries(const Core::Point &newPosition) const;
+
+        /**
+         * @brief Whether a circle overlaps the area, e.g. to cull entities outside the view.
+         */
+        bool overlapsCircle(const Core::Point &center, float radius) const;
     };
 }
\ No newline at end of file
@@ -1,15 +1,169 @@
 #include "simulation/simulation.hpp"
 #include "render/render.hpp"
 #include "render/renderEngines.hpp"
+#include "render/renderSettings.hpp"
+#include "render/statsReport.hpp"
 #include "utils/randomGenerator.hpp"
 #include "utils/consoleLogger.hpp"
 
 #include "memory"
+#include "cstdint"
+#include "cstdlib"
+#include "iostream"
+#include "string"
+#include "string_view"
 
-int main()
+namespace
 {
-    const auto logger = std::make_shared<AntColony::Utils::ConsoleLogger>();
-    auto renderCtx = AntColony::Render::initRenderContext(AntColony::Render::OPENGL, logger);
+    constexpr const std::string_view FPS_OPTION = "--fps=";
+    constexpr const std::string_view ENGINE_OPTION = "--engine=";
+    constexpr const std::string_view SIZE_OPTION = "--size=";
+    constexpr const std::string_view FRAMES_OPTION = "--frames=";
+    constexpr const std::string_view THREADS_OPTION = "--threads=";
+    constexpr const std::string_view CIRCLES_OPTION = "--circles=";
+    constexpr const std::string_view CAPTURE_OPTION = "--capture=";
+    constexpr const std::string_view CAPTURE_PATH_OPTION = "--capture-path=";
+    constexpr const std::string_view STATS_JSON_OPTION = "--stats-json=";
+    constexpr const std::string_view SEED_FOOD_OPTION = "--seed-food=";
+    constexpr const std::string_view MAX_PHEROMONES_OPTION = "--max-pheromones=";
+    constexpr const std::string_view REORDER_INTERVAL_OPTION = "--reorder-interval=";
+
+    struct Options
+    {
+        AntColony::Render::RENDER_ENGINE engine = AntColony::Render::OPENGL;
+        AntColony::Render::RenderSettings renderSettings;
+        AntColony::Simulation::PHEROMONE_RENDER_MODE pheromoneRenderMode = AntColony::Simulation::CIRCLES;
+        /// @brief Merge pheromone deposits into the pheromone already in their cell.
+        bool coalescePheromones = false;
+        /// @brief Live pheromone limit, 0 for none.
+        std::size_t maxPheromones = 0;
+        /// @brief Ticks between Morton reorders of ants and pheromones, 0 for none.
+        int reorderInterval = 0;
+        /// @brief Draw the previous frame's render statistics on top of the scene.
+        bool statsOverlay = false;
+        /// @brief File receiving per-frame render statistics as JSON Lines, "-" for stdout, empty to disable.
+        std::string statsJsonPath;
+        /// @brief Food patches placed before the first frame.
+        std::size_t seedFood = 0;
+    };
+
+    /**
+     * @brief Reads the positive number following an option prefix.
+     */
+    bool tryParseValue(const std::string &arg, std::string_view option, float &value)
+    {
+        if (arg.rfind(option, 0) != 0)
+            return false;
+
+        value = std::strtof(arg.c_str() + option.size(), nullptr);
+        return value > 0.0f;
+    }
+
+    bool tryParseOptions(int argc, char **argv, Options &options, AntColony::Core::Logger &logger)
+    {
+        auto &settings = options.renderSettings;
+
+        for (auto i = 1; i < argc; i++)
+        {
+            const std::string arg = argv[i];
+            auto value = 0.0f;
+
+            if (arg == "--uncapped")
+                settings.pacing = AntColony::Render::UNCAPPED;
+            else if (arg == "--vsync")
+                settings.pacing = AntColony::Render::VSYNC;
+            else if (tryParseValue(arg, FPS_OPTION, value))
+                settings.frameTime = 1000.0f / value;
+            else if (arg == "--frame-stats")
+                settings.reportFrameStats = true;
+            else if (arg == "--stats-overlay")
+                options.statsOverlay = true;
+            else if (arg.rfind(STATS_JSON_OPTION, 0) == 0 && arg.size() > STATS_JSON_OPTION.size())
+                options.statsJsonPath = arg.substr(STATS_JSON_OPTION.size());
+            else if (arg == "--offscreen")
+                settings.offscreen = true;
+            else if (arg == "--gl-debug")
+                settings.debugOutput = true;
+            else if (arg.rfind(CIRCLES_OPTION, 0) == 0)
+            {
+                if (!AntColony::Render::tryParseCircleRenderMode(std::string_view(arg).substr(CIRCLES_OPTION.size()), settings.circleMode))
+                {
+                    logger.error("Unknown circle render mode: " + arg.substr(CIRCLES_OPTION.size()) + ", expected quad or fan");
+                    return false;
+                }
+            }
+            else if (arg == "--heatmap")
+                options.pheromoneRenderMode = AntColony::Simulation::HEATMAP;
+            else if (arg == "--coalesce-pheromones")
+                options.coalescePheromones = true;
+            else if (arg.rfind(ENGINE_OPTION, 0) == 0 && arg.substr(ENGINE_OPTION.size()) == "software")
+                options.engine = AntColony::Render::SOFTWARE;
+            else if (arg.rfind(ENGINE_OPTION, 0) == 0 && arg.substr(ENGINE_OPTION.size()) == "opengl")
+                options.engine = AntColony::Render::OPENGL;
+            else if (tryParseValue(arg, SIZE_OPTION, value))
+                settings.width = settings.height = static_cast<int>(value);
+            else if (tryParseValue(arg, FRAMES_OPTION, value))
+                settings.frameLimit = static_cast<int>(value);
+            else if (tryParseValue(arg, THREADS_OPTION, value))
+                settings.renderThreads = static_cast<unsigned int>(value);
+            else if (tryParseValue(arg, SEED_FOOD_OPTION, value))
+                options.seedFood = static_cast<std::size_t>(value);
+            else if (tryParseValue(arg, MAX_PHEROMONES_OPTION, value))
+                options.maxPheromones = static_cast<std::size_t>(value);
+            else if (tryParseValue(arg, REORDER_INTERVAL_OPTION, value))
+                options.reorderInterval = static_cast<int>(value);
+            else if (arg.rfind(CAPTURE_OPTION, 0) == 0 && arg.substr(CAPTURE_OPTION.size()) == "y4m")
+                settings.captureFormat = AntColony::Render::Capture::Y4M;
+            else if (arg.rfind(CAPTURE_OPTION, 0) == 0 && arg.substr(CAPTURE_OPTION.size()) == "ppm")
+                settings.captureFormat = AntColony::Render::Capture::PPM;
+            else if (arg.rfind(CAPTURE_PATH_OPTION, 0) == 0 && arg.size() > CAPTURE_PATH_OPTION.size())
+                settings.capturePath = arg.substr(CAPTURE_PATH_OPTION.size());
+            else
+            {
+                logger.error("Unknown option: " + arg);
+                logger.info("Options: --engine=<opengl|software>, --uncapped | --vsync | --fps=<rate>, --frame-stats, "
+                            "--size=<pixels>, --frames=<count>, --threads=<count>, --capture=<y4m|ppm>, --capture-path=<path|->, --stats-overlay, --stats-json=<path|->, --offscreen, --gl-debug, --circles=<quad|fan>, --heatmap, --coalesce-pheromones, --max-pheromones=<count>, --reorder-interval=<ticks>, --seed-food=<count>");
+                return false;
+            }
+        }
+
+        if (settings.captureFormat != AntColony::Render::Capture::NO_CAPTURE && settings.capturePath == "-" && options.statsJsonPath == "-")
+        {
+            logger.error("Captured frames and render statistics cannot both be written to stdout");
+            return false;
+        }
+
+        if (options.engine == AntColony::Render::SOFTWARE && settings.frameLimit == 0)
+            logger.warning("Software engine has no window to close, pass --frames=<count> to stop it");
+        else if (settings.offscreen && settings.frameLimit == 0)
+            logger.warning("Offscreen rendering has no window to close, pass --frames=<count> to stop it");
+
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::shared_ptr<AntColony::Core::Logger> logger = std::make_shared<AntColony::Utils::ConsoleLogger>();
+
+    Options options;
+    if (!tryParseOptions(argc, argv, options, *logger))
+        return -1;
+
+    // Frames or statistics written to stdout must not be interleaved with log lines
+    const auto &settings = options.renderSettings;
+    if ((settings.captureFormat != AntColony::Render::Capture::NO_CAPTURE && settings.capturePath == "-") || options.statsJsonPath == "-")
+        logger = std::make_shared<AntColony::Utils::ConsoleLogger>(std::cerr);
+
+    std::unique_ptr<AntColony::Render::StatsJsonWriter> statsWriter;
+    if (!options.statsJsonPath.empty())
+    {
+        statsWriter = std::make_unique<AntColony::Render::StatsJsonWriter>(options.statsJsonPath, logger);
+        if (!statsWriter->isOpen())
+            return -1;
+    }
+
+    auto renderCtx = AntColony::Render::initRenderContext(options.engine, logger, options.renderSettings);
 
     if (!renderCtx->getInited())
         return -1;
@@ -18,18 +172,33 @@ int main()
     AntColony::Utils::RandomGenerator::getInstance().seed();
 
     AntColony::Simulation::Simulation simulation(logger);
+    simulation.setPheromoneRenderMode(options.pheromoneRenderMode);
+    simulation.setPheromoneCoalescing(options.coalescePheromones);
+    simulation.setMaxPheromones(options.maxPheromones);
+    simulation.setReorderInterval(options.reorderInterval);
+    if (options.seedFood > 0)
+        simulation.seedFood(options.seedFood);
 
+    std::uint64_t frameIndex = 0;
     while (!renderCtx->shouldClose())
     {
-        auto frameCtx = renderCtx->getFrameContext();
+        auto &frameCtx = renderCtx->beginFrame();
+
+        simulation.update(frameCtx);
+        simulation.render(frameCtx);
 
-        frameCtx->onBeforeRender();
+        if (options.statsOverlay)
+            AntColony::Render::drawStatsOverlay(frameCtx.getRenderer(), frameCtx.getStats());
 
-        simulation.update(*frameCtx);
-        simulation.render(*frameCtx);
+        renderCtx->endFrame();
 
-        frameCtx->onAfterRender();
+        if (statsWriter)
+            statsWriter->write(frameIndex, frameCtx.getStats());
+        frameIndex++;
     }
 
+    if (options.maxPheromones > 0)
+        logger->info("Pheromones evicted by the limit: " + std::to_string(simulation.getPheromoneEvictions()));
+
     return 0;
 }
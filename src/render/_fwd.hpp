@@ -3,4 +3,7 @@ namespace AntColony::Render
     class RenderContext;
     class FrameContext;
     class Renderer;
+    class Camera;
+    struct RenderSettings;
+    struct RenderStats;
 }
\ No newline at end of file
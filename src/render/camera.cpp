@@ -0,0 +1,67 @@
+#include "camera.hpp"
+
+#include <algorithm>
+
+namespace AntColony::Render
+{
+    namespace
+    {
+        // Far enough out that ants fall below a pixel at common frame sizes and are splatted
+        constexpr const float MIN_ZOOM = 0.02f;
+        constexpr const float MAX_ZOOM = 50.0f;
+    }
+
+    Camera::Camera() : center(0.0f, 0.0f), zoom(1.0f), viewportWidth(0), viewportHeight(0), revision(0) {}
+
+    Core::Point Camera::worldToView(const Core::Point &position) const { return (position - center) * zoom; }
+
+    float Camera::worldToView(float length) const { return length * zoom; }
+
+    float Camera::worldToPixels(float length) const
+    {
+        // The view is square, the shorter side spans the two view units
+        return worldToView(length) * (std::min(viewportWidth, viewportHeight) / 2.0f);
+    }
+
+    Core::Point Camera::viewToWorld(const Core::Point &position) const { return position * (1.0f / zoom) + center; }
+
+    Core::ViewPort Camera::getVisibleArea() const
+    {
+        const auto halfExtent = 1.0f / zoom;
+        return Core::ViewPort(center.x - halfExtent, center.y - halfExtent, center.x + halfExtent, center.y + halfExtent);
+    }
+
+    void Camera::pan(const Core::Point &viewDelta)
+    {
+        center = center - viewDelta * (1.0f / zoom);
+        revision++;
+    }
+
+    void Camera::zoomAt(float factor, const Core::Point &viewAnchor)
+    {
+        const auto anchor = viewToWorld(viewAnchor);
+        zoom = std::clamp(zoom * factor, MIN_ZOOM, MAX_ZOOM);
+
+        // Move the center so the anchor maps to the same view position as before
+        center = anchor - viewAnchor * (1.0f / zoom);
+        revision++;
+    }
+
+    void Camera::reset()
+    {
+        center = Core::Point(0.0f, 0.0f);
+        zoom = 1.0f;
+        revision++;
+    }
+
+    void Camera::setViewportSize(int width, int height)
+    {
+        viewportWidth = width;
+        viewportHeight = height;
+    }
+
+    float Camera::getZoom() const { return zoom; }
+    int Camera::getViewportWidth() const { return viewportWidth; }
+    int Camera::getViewportHeight() const { return viewportHeight; }
+    std::uint32_t Camera::getRevision() const { return revision; }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../core/_fwd.hpp"
+#include "../core/point.hpp"
+#include "../core/viewPort.hpp"
+
+#include <cstdint>
+
+namespace AntColony::Render
+{
+    /**
+     * @brief Maps world coordinates to normalized view coordinates with zoom and pan.
+     *
+     * The default camera is the identity, world [-1,1] fills the view. Text is not transformed,
+     * it is drawn in view coordinates as a HUD.
+     */
+    class Camera
+    {
+    public:
+        Camera();
+
+        /**
+         * @brief World position to normalized view coordinates in [-1,1] when visible.
+         */
+        Core::Point worldToView(const Core::Point &position) const;
+
+        /**
+         * @brief World length, e.g. a radius, to view units.
+         */
+        float worldToView(float length) const;
+
+        /**
+         * @brief World length to pixels of the viewport, e.g. to pick a level of detail.
+         */
+        float worldToPixels(float length) const;
+
+        /**
+         * @brief Normalized view coordinates to a world position.
+         */
+        Core::Point viewToWorld(const Core::Point &position) const;
+
+        /**
+         * @brief World rectangle covered by the view, for culling before submission.
+         */
+        Core::ViewPort getVisibleArea() const;
+
+        /**
+         * @brief Moves the view by a distance in view units, following the cursor when dragging.
+         */
+        void pan(const Core::Point &viewDelta);
+
+        /**
+         * @brief Scales the zoom, keeping the world point under the anchor fixed.
+         * @param factor Zoom multiplier, above 1 zooms in.
+         * @param viewAnchor Anchor in normalized view coordinates, e.g. the cursor.
+         */
+        void zoomAt(float factor, const Core::Point &viewAnchor);
+
+        /**
+         * @brief Restores the identity view.
+         */
+        void reset();
+
+        /**
+         * @brief Sets the size in pixels of the target the view is mapped to, set by the render context every frame.
+         */
+        void setViewportSize(int width, int height);
+
+        float getZoom() const;
+        int getViewportWidth() const;
+        int getViewportHeight() const;
+
+        /**
+         * @brief Incremented on every change, lets cached views detect a moved camera.
+         */
+        std::uint32_t getRevision() const;
+
+    private:
+        /// @brief World position at the view center.
+        Core::Point center;
+        /// @brief View units per world unit.
+        float zoom;
+        /// @brief Target size in pixels, does not change the revision as it only affects the level of detail.
+        int viewportWidth;
+        int viewportHeight;
+        std::uint32_t revision;
+    };
+}
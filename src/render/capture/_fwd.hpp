@@ -0,0 +1,5 @@
+namespace AntColony::Render::Capture
+{
+    struct CapturedFrame;
+    class FrameWriter;
+}
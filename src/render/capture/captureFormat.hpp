@@ -0,0 +1,17 @@
+#pragma once
+
+namespace AntColony::Render::Capture
+{
+    /**
+     * @brief Encoding of captured frames.
+     */
+    enum CAPTURE_FORMAT
+    {
+        /// @brief Capture disabled.
+        NO_CAPTURE,
+        /// @brief Single YUV4MPEG2 stream with 4:2:0 chroma, readable by ffmpeg and most players.
+        Y4M,
+        /// @brief Binary RGB PPM per frame, numbered files in a directory or concatenated on stdout.
+        PPM,
+    };
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace AntColony::Render::Capture
+{
+    /**
+     * @brief Pooled RGBA8 frame buffer passed from a render context to the frame writer.
+     */
+    struct CapturedFrame
+    {
+        /// @brief Tightly packed RGBA8 rows.
+        std::vector<std::uint8_t> pixels;
+        /// @brief True when row 0 is the bottom of the image, as read back from GL.
+        bool bottomUp = false;
+        /// @brief Index of the rendered frame the pixels belong to.
+        std::uint64_t frameIndex = 0;
+    };
+}
@@ -0,0 +1,316 @@
+#include "frameWriter.hpp"
+
+#include "../renderSettings.hpp"
+#include "../../core/logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+
+namespace AntColony::Render::Capture
+{
+    namespace
+    {
+        constexpr const char *STDOUT_PATH = "-";
+        constexpr const int BYTES_PER_PIXEL = 4;
+        constexpr const int PPM_BYTES_PER_PIXEL = 3;
+
+        // Large stdio buffer so a 1080p frame goes out in a handful of writes
+        constexpr const std::size_t OUTPUT_BUFFER_SIZE = 1 << 22;
+
+        // Y4M frame rate is a fraction, keep millihertz precision
+        constexpr const int FRAME_RATE_DENOMINATOR = 1000;
+
+        // BT.601 limited range, 8.8 fixed point
+        inline std::uint8_t toLuma(int r, int g, int b) { return static_cast<std::uint8_t>(16 + ((66 * r + 129 * g + 25 * b + 128) >> 8)); }
+        inline std::uint8_t toChromaU(int r, int g, int b) { return static_cast<std::uint8_t>(128 + ((-38 * r - 74 * g + 112 * b + 128) >> 8)); }
+        inline std::uint8_t toChromaV(int r, int g, int b) { return static_cast<std::uint8_t>(128 + ((112 * r - 94 * g - 18 * b + 128) >> 8)); }
+    }
+
+    std::unique_ptr<FrameWriter> FrameWriter::create(const RenderSettings &settings, std::shared_ptr<Core::Logger> logger)
+    {
+        if (settings.captureFormat == NO_CAPTURE)
+            return nullptr;
+
+        auto writer = std::make_unique<FrameWriter>(
+            settings.captureFormat,
+            settings.capturePath,
+            settings.width,
+            settings.height,
+            std::max(1u, settings.captureQueueSize),
+            1000.0f / settings.frameTime,
+            logger);
+
+        return writer->isOpen() ? std::move(writer) : nullptr;
+    }
+
+    FrameWriter::FrameWriter(CAPTURE_FORMAT format,
+                             const std::string &path,
+                             int width,
+                             int height,
+                             unsigned int queueSize,
+                             float frameRate,
+                             std::shared_ptr<Core::Logger> logger)
+        : logger(logger),
+          format(format),
+          path(path),
+          width(width),
+          height(height),
+          frameRate(frameRate),
+          output(nullptr),
+          ownsOutput(false),
+          stopping(false),
+          writtenFrames(0),
+          droppedFrames(0)
+    {
+        if (!openOutput())
+            return;
+
+        const auto frameSize = static_cast<std::size_t>(width) * height * BYTES_PER_PIXEL;
+        frames.reserve(queueSize);
+        freeFrames.reserve(queueSize);
+        for (auto i = 0u; i < queueSize; i++)
+        {
+            frames.push_back(std::make_unique<CapturedFrame>());
+            frames.back()->pixels.resize(frameSize);
+            freeFrames.push_back(frames.back().get());
+        }
+
+        thread = std::thread(&FrameWriter::writerLoop, this);
+        logger->info("Capturing " + std::to_string(width) + "x" + std::to_string(height) +
+                     (format == Y4M ? " Y4M to " : " PPM to ") + (path == STDOUT_PATH ? "stdout" : path));
+    }
+
+    FrameWriter::~FrameWriter()
+    {
+        if (thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            pendingCondition.notify_one();
+            thread.join();
+
+            logger->info("Capture finished: " + std::to_string(writtenFrames) + " frames written, " +
+                         std::to_string(droppedFrames) + " dropped");
+        }
+
+        if (output && ownsOutput)
+            std::fclose(output);
+        else if (output)
+            std::fflush(output);
+    }
+
+    bool FrameWriter::isOpen() const { return thread.joinable(); }
+    int FrameWriter::getWidth() const { return width; }
+    int FrameWriter::getHeight() const { return height; }
+
+    bool FrameWriter::openOutput()
+    {
+        if (width <= 0 || height <= 0)
+        {
+            logger->error("Invalid capture size: " + std::to_string(width) + "x" + std::to_string(height));
+            return false;
+        }
+
+        if (path == STDOUT_PATH)
+        {
+            output = stdout;
+        }
+        else if (format == PPM)
+        {
+            std::error_code error;
+            std::filesystem::create_directories(path, error);
+            if (error)
+            {
+                logger->error("Failed to create capture directory: " + path + " (" + error.message() + ")");
+                return false;
+            }
+            return true;
+        }
+        else
+        {
+            output = std::fopen(path.c_str(), "wb");
+            ownsOutput = true;
+        }
+
+        if (!output)
+        {
+            logger->error("Failed to open capture output: " + path);
+            return false;
+        }
+
+        std::setvbuf(output, nullptr, _IOFBF, OUTPUT_BUFFER_SIZE);
+
+        if (format == Y4M)
+        {
+            const auto rate = static_cast<long>(std::lround(frameRate * FRAME_RATE_DENOMINATOR));
+            std::fprintf(output, "YUV4MPEG2 W%d H%d F%ld:%d Ip A1:1 C420jpeg\n", width, height, rate, FRAME_RATE_DENOMINATOR);
+        }
+
+        return true;
+    }
+
+    CapturedFrame *FrameWriter::acquireFrame()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (freeFrames.empty())
+        {
+            droppedFrames++;
+            return nullptr;
+        }
+
+        auto *frame = freeFrames.back();
+        freeFrames.pop_back();
+        return frame;
+    }
+
+    void FrameWriter::submitFrame(CapturedFrame *frame)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pendingFrames.push_back(frame);
+        }
+        pendingCondition.notify_one();
+    }
+
+    void FrameWriter::releaseFrame(CapturedFrame *frame)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        freeFrames.push_back(frame);
+    }
+
+    void FrameWriter::writerLoop()
+    {
+        auto failed = false;
+
+        while (true)
+        {
+            CapturedFrame *frame = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                pendingCondition.wait(lock, [this]
+                                      { return stopping || !pendingFrames.empty(); });
+                if (pendingFrames.empty())
+                    return;
+
+                frame = pendingFrames.front();
+                pendingFrames.pop_front();
+            }
+
+            // Keep draining after an error so the render loop never waits on a full pool
+            if (!failed && !writeFrame(*frame))
+            {
+                logger->error("Failed to write captured frame " + std::to_string(frame->frameIndex) + ", capture stopped");
+                failed = true;
+            }
+            else if (!failed)
+            {
+                writtenFrames++;
+            }
+
+            releaseFrame(frame);
+        }
+    }
+
+    const std::uint8_t *FrameWriter::getRow(const CapturedFrame &frame, int y) const
+    {
+        const auto row = frame.bottomUp ? height - 1 - y : y;
+        return frame.pixels.data() + static_cast<std::size_t>(row) * width * BYTES_PER_PIXEL;
+    }
+
+    bool FrameWriter::writeFrame(const CapturedFrame &frame)
+    {
+        if (format == PPM)
+        {
+            encodePpm(frame);
+
+            if (output)
+                return std::fwrite(encoded.data(), 1, encoded.size(), output) == encoded.size();
+
+            char fileName[32];
+            std::snprintf(fileName, sizeof(fileName), "frame_%06llu.ppm", static_cast<unsigned long long>(frame.frameIndex));
+            const auto filePath = (std::filesystem::path(path) / fileName).string();
+
+            auto *file = std::fopen(filePath.c_str(), "wb");
+            if (!file)
+                return false;
+
+            const auto written = std::fwrite(encoded.data(), 1, encoded.size(), file) == encoded.size();
+            return std::fclose(file) == 0 && written;
+        }
+
+        encodeY4m(frame);
+        return std::fwrite(encoded.data(), 1, encoded.size(), output) == encoded.size();
+    }
+
+    void FrameWriter::encodePpm(const CapturedFrame &frame)
+    {
+        char header[32];
+        const auto headerLength = std::snprintf(header, sizeof(header), "P6\n%d %d\n255\n", width, height);
+
+        encoded.resize(headerLength + static_cast<std::size_t>(width) * height * PPM_BYTES_PER_PIXEL);
+        auto *out = std::copy(header, header + headerLength, encoded.data());
+
+        for (auto y = 0; y < height; y++)
+        {
+            const auto *in = getRow(frame, y);
+            for (auto x = 0; x < width; x++, in += BYTES_PER_PIXEL)
+            {
+                *out++ = in[0];
+                *out++ = in[1];
+                *out++ = in[2];
+            }
+        }
+    }
+
+    void FrameWriter::encodeY4m(const CapturedFrame &frame)
+    {
+        constexpr const char FRAME_HEADER[] = "FRAME\n";
+        constexpr const auto FRAME_HEADER_LENGTH = sizeof(FRAME_HEADER) - 1;
+
+        const auto chromaWidth = (width + 1) / 2;
+        const auto chromaHeight = (height + 1) / 2;
+        const auto lumaSize = static_cast<std::size_t>(width) * height;
+        const auto chromaSize = static_cast<std::size_t>(chromaWidth) * chromaHeight;
+
+        encoded.resize(FRAME_HEADER_LENGTH + lumaSize + 2 * chromaSize);
+        std::copy(FRAME_HEADER, FRAME_HEADER + FRAME_HEADER_LENGTH, encoded.data());
+
+        auto *lumaPlane = encoded.data() + FRAME_HEADER_LENGTH;
+        auto *uPlane = lumaPlane + lumaSize;
+        auto *vPlane = uPlane + chromaSize;
+
+        // Each 2x2 block writes its luma samples and one averaged chroma pair
+        for (auto cy = 0; cy < chromaHeight; cy++)
+        {
+            const auto y0 = cy * 2;
+            const auto y1 = std::min(y0 + 1, height - 1);
+            const auto *row0 = getRow(frame, y0);
+            const auto *row1 = getRow(frame, y1);
+
+            for (auto cx = 0; cx < chromaWidth; cx++)
+            {
+                const auto x0 = cx * 2;
+                const auto x1 = std::min(x0 + 1, width - 1);
+                const std::uint8_t *block[4] = {
+                    row0 + x0 * BYTES_PER_PIXEL,
+                    row0 + x1 * BYTES_PER_PIXEL,
+                    row1 + x0 * BYTES_PER_PIXEL,
+                    row1 + x1 * BYTES_PER_PIXEL};
+
+                lumaPlane[y0 * width + x0] = toLuma(block[0][0], block[0][1], block[0][2]);
+                lumaPlane[y0 * width + x1] = toLuma(block[1][0], block[1][1], block[1][2]);
+                lumaPlane[y1 * width + x0] = toLuma(block[2][0], block[2][1], block[2][2]);
+                lumaPlane[y1 * width + x1] = toLuma(block[3][0], block[3][1], block[3][2]);
+
+                const auto r = (block[0][0] + block[1][0] + block[2][0] + block[3][0] + 2) / 4;
+                const auto g = (block[0][1] + block[1][1] + block[2][1] + block[3][1] + 2) / 4;
+                const auto b = (block[0][2] + block[1][2] + block[2][2] + block[3][2] + 2) / 4;
+                uPlane[cy * chromaWidth + cx] = toChromaU(r, g, b);
+                vPlane[cy * chromaWidth + cx] = toChromaV(r, g, b);
+            }
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "_fwd.hpp"
+#include "../_fwd.hpp"
+#include "../../core/_fwd.hpp"
+#include "captureFormat.hpp"
+#include "capturedFrame.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AntColony::Render::Capture
+{
+    /**
+     * @brief Encodes captured frames on a dedicated thread.
+     *
+     * Frames come from a fixed pool. When the writer falls behind and the pool runs dry, new
+     * frames are dropped instead of blocking the render loop.
+     */
+    class FrameWriter
+    {
+    public:
+        /**
+         * @brief Creates the writer configured by the render settings.
+         * @return Writer, or nullptr if capture is disabled or the output could not be opened.
+         */
+        static std::unique_ptr<FrameWriter> create(const RenderSettings &settings, std::shared_ptr<Core::Logger> logger);
+
+        /**
+         * @brief Opens the output and starts the writer thread.
+         * @param format Encoding of written frames.
+         * @param path Y4M file or PPM directory, "-" writes to stdout.
+         * @param width Frame width in pixels.
+         * @param height Frame height in pixels.
+         * @param queueSize Number of pooled frames.
+         * @param frameRate Nominal frame rate recorded in the Y4M header.
+         * @param logger Shared pointer to the logger instance.
+         */
+        FrameWriter(CAPTURE_FORMAT format,
+                    const std::string &path,
+                    int width,
+                    int height,
+                    unsigned int queueSize,
+                    float frameRate,
+                    std::shared_ptr<Core::Logger> logger);
+
+        /**
+         * @brief Writes all queued frames, closes the output and logs a summary.
+         */
+        ~FrameWriter();
+
+        FrameWriter(const FrameWriter &) = delete;
+        FrameWriter &operator=(const FrameWriter &) = delete;
+
+        /**
+         * @brief Whether the output was opened.
+         */
+        bool isOpen() const;
+
+        int getWidth() const;
+        int getHeight() const;
+
+        /**
+         * @brief Takes a free frame from the pool.
+         * @return Frame sized for width * height RGBA pixels, or nullptr if the writer is behind and the frame is dropped.
+         */
+        CapturedFrame *acquireFrame();
+
+        /**
+         * @brief Queues an acquired frame for encoding.
+         */
+        void submitFrame(CapturedFrame *frame);
+
+        /**
+         * @brief Returns an acquired frame to the pool without writing it.
+         */
+        void releaseFrame(CapturedFrame *frame);
+
+    private:
+        const std::shared_ptr<Core::Logger> logger;
+        const CAPTURE_FORMAT format;
+        const std::string path;
+        const int width;
+        const int height;
+        const float frameRate;
+
+        /// @brief Open Y4M stream, or stdout for PPM; PPM files are opened per frame.
+        std::FILE *output;
+        bool ownsOutput;
+
+        std::vector<std::unique_ptr<CapturedFrame>> frames;
+        std::vector<CapturedFrame *> freeFrames;
+        std::deque<CapturedFrame *> pendingFrames;
+
+        std::mutex mutex;
+        std::condition_variable pendingCondition;
+        bool stopping;
+        std::thread thread;
+
+        /// @brief Written by the writer thread only.
+        std::uint64_t writtenFrames;
+        /// @brief Updated under the mutex.
+        std::uint64_t droppedFrames;
+
+        /// @brief Conversion scratch, owned by the writer thread.
+        std::vector<std::uint8_t> encoded;
+
+        bool openOutput();
+        void writerLoop();
+        bool writeFrame(const CapturedFrame &frame);
+        void encodePpm(const CapturedFrame &frame);
+        void encodeY4m(const CapturedFrame &frame);
+
+        /**
+         * @brief Source row for an output row, accounting for bottom-up frames.
+         */
+        const std::uint8_t *getRow(const CapturedFrame &frame, int y) const;
+    };
+}
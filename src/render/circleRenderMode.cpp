@@ -0,0 +1,16 @@
+#include "circleRenderMode.hpp"
+
+namespace AntColony::Render
+{
+    bool tryParseCircleRenderMode(std::string_view name, CIRCLE_RENDER_MODE &mode)
+    {
+        if (name == "quad")
+            mode = SDF_QUAD;
+        else if (name == "fan")
+            mode = TRIANGLE_FAN;
+        else
+            return false;
+
+        return true;
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string_view>
+
+namespace AntColony::Render
+{
+    /**
+     * @brief How the OpenGL engine rasterises circles, the software engine always uses coverage spans.
+     */
+    enum CIRCLE_RENDER_MODE
+    {
+        /// @brief Tessellated triangle fan, fixed vertex count per circle.
+        TRIANGLE_FAN,
+        /// @brief Screen-aligned quad shaded with an analytic distance test.
+        SDF_QUAD,
+    };
+
+    /**
+     * @brief Reads a circle render mode from its command line name, "quad" or "fan".
+     * @return False if the name is unknown, mode is then left unchanged.
+     */
+    bool tryParseCircleRenderMode(std::string_view name, CIRCLE_RENDER_MODE &mode);
+}
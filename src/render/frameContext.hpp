@@ -1,16 +1,30 @@
 #pragma once
 
 #include "_fwd.hpp"
-#include <memory>
 
 namespace AntColony::Render
 {
+    /**
+     * @brief Per-frame view handed out by RenderContext::beginFrame.
+     *
+     * The object is owned by its render context and reused for every frame,
+     * so it must not be retained past the matching endFrame call.
+     */
     class FrameContext
     {
     public:
-        virtual void onBeforeRender() = 0;
-        virtual void onAfterRender() = 0;
-        virtual const std::shared_ptr<Renderer> getRenderer() const = 0;
+        virtual Renderer &getRenderer() const = 0;
+
+        /**
+         * @brief Statistics of the last completed frame.
+         */
+        virtual const RenderStats &getStats() const = 0;
+
+        /**
+         * @brief Camera the renderer maps world coordinates with, use its visible area to cull.
+         */
+        virtual const Camera &getCamera() const = 0;
+
         virtual ~FrameContext() {}
     };
 }
@@ -0,0 +1,112 @@
+#include "framePacer.hpp"
+
+#include "../core/logger.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+namespace AntColony::Render
+{
+    // Coarse sleep stops this long before the deadline, the rest is spun to avoid scheduler jitter
+    constexpr auto SPIN_THRESHOLD = std::chrono::microseconds(2000);
+    // Frames that overrun by more than this many periods re-base the deadline instead of catching up
+    constexpr auto MAX_LAG_FRAMES = 2;
+    // Statistics are reported once per window
+    constexpr auto STATS_WINDOW = std::chrono::seconds(1);
+    constexpr auto STATS_RESERVE = 4096;
+
+    FramePacer::FramePacer(const RenderSettings &settings, std::shared_ptr<Core::Logger> logger)
+        : logger(logger),
+          pacing(settings.pacing),
+          period(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(settings.frameTime))),
+          reportStats(settings.reportFrameStats || settings.pacing == UNCAPPED)
+    {
+        frameTimes.reserve(STATS_RESERVE);
+        sortedFrameTimes.reserve(STATS_RESERVE);
+        reset();
+    }
+
+    void FramePacer::reset()
+    {
+        const auto now = Clock::now();
+        deadline = now + period;
+        lastFrameEnd = now;
+        windowStart = now;
+        frameTimes.clear();
+    }
+
+    void FramePacer::waitForNextFrame()
+    {
+        if (pacing == FIXED_RATE)
+        {
+            sleepUntilDeadline();
+
+            // Advance by whole periods so a late wake-up does not shift later frames
+            deadline += period;
+            const auto now = Clock::now();
+            if (now > deadline + period * MAX_LAG_FRAMES)
+            {
+                deadline = now + period;
+            }
+        }
+
+        if (reportStats)
+        {
+            recordFrame(Clock::now());
+        }
+    }
+
+    void FramePacer::sleepUntilDeadline() const
+    {
+        const auto coarseDeadline = deadline - SPIN_THRESHOLD;
+        if (Clock::now() < coarseDeadline)
+        {
+            std::this_thread::sleep_until(coarseDeadline);
+        }
+
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void FramePacer::recordFrame(Clock::time_point now)
+    {
+        const auto frameTime = std::chrono::duration<float, std::milli>(now - lastFrameEnd).count();
+        lastFrameEnd = now;
+        frameTimes.push_back(frameTime);
+
+        if (now - windowStart >= STATS_WINDOW)
+        {
+            reportWindow(now);
+        }
+    }
+
+    void FramePacer::reportWindow(Clock::time_point now)
+    {
+        if (frameTimes.empty())
+            return;
+
+        const auto windowSeconds = std::chrono::duration<float>(now - windowStart).count();
+        const auto fps = static_cast<float>(frameTimes.size()) / windowSeconds;
+
+        sortedFrameTimes.assign(frameTimes.begin(), frameTimes.end());
+        std::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
+        const auto percentile = [this](float p)
+        {
+            const auto index = static_cast<size_t>(p * static_cast<float>(sortedFrameTimes.size() - 1));
+            return sortedFrameTimes[index];
+        };
+
+        char message[160];
+        std::snprintf(message, sizeof(message),
+                      "Frames: %zu, FPS: %.1f, frame time ms p50: %.3f, p95: %.3f, p99: %.3f, max: %.3f",
+                      frameTimes.size(), fps, percentile(0.50f), percentile(0.95f), percentile(0.99f), sortedFrameTimes.back());
+        logger->info(message);
+
+        frameTimes.clear();
+        windowStart = now;
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "../core/_fwd.hpp"
+#include "renderSettings.hpp"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace AntColony::Render
+{
+    /**
+     * @brief Paces the render loop against absolute deadlines and collects frame-time statistics.
+     *
+     * Fixed-rate frames sleep coarsely and spin for the last stretch, and deadlines advance by whole
+     * frame periods, so oversleeping in one frame is absorbed by the next rather than accumulating.
+     */
+    class FramePacer
+    {
+    public:
+        /**
+         * @brief Constructor with pacing settings and logger for statistics.
+         * @param settings Render settings with the pacing strategy and frame time.
+         * @param logger Shared pointer to the logger instance.
+         */
+        FramePacer(const RenderSettings &settings, std::shared_ptr<Core::Logger> logger);
+
+        /**
+         * @brief Waits until the next frame deadline and records the elapsed frame time.
+         */
+        void waitForNextFrame();
+
+        /**
+         * @brief Restarts deadlines from now, e.g. after a long stall.
+         */
+        void reset();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief Shared pointer to the logger for statistics.
+        std::shared_ptr<Core::Logger> logger;
+        /// @brief Active pacing strategy.
+        FRAME_PACING pacing;
+        /// @brief Target frame period for FIXED_RATE pacing.
+        Clock::duration period;
+        /// @brief Whether statistics are reported.
+        bool reportStats;
+        /// @brief Absolute deadline of the current frame.
+        Clock::time_point deadline;
+        /// @brief End of the previous frame, used to measure frame times.
+        Clock::time_point lastFrameEnd;
+        /// @brief Start of the current statistics window.
+        Clock::time_point windowStart;
+        /// @brief Frame times in milliseconds within the current statistics window.
+        std::vector<float> frameTimes;
+        /// @brief Scratch copy for percentile selection, kept to avoid per-report allocations.
+        std::vector<float> sortedFrameTimes;
+
+        /**
+         * @brief Sleeps until shortly before the deadline, then spins until it passes.
+         */
+        void sleepUntilDeadline() const;
+
+        /**
+         * @brief Records a frame time and reports the window when it is complete.
+         * @param now Time the frame ended.
+         */
+        void recordFrame(Clock::time_point now);
+
+        /**
+         * @brief Logs achieved FPS and frame-time percentiles for the current window and starts a new one.
+         * @param now Time the window ended.
+         */
+        void reportWindow(Clock::time_point now);
+    };
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace AntColony::Render
+{
+    /**
+     * @brief How the render loop is paced.
+     */
+    enum FRAME_PACING
+    {
+        /// @brief Sleep and spin to a fixed frame time.
+        FIXED_RATE,
+        /// @brief Let buffer swaps wait for the display refresh.
+        VSYNC,
+        /// @brief Run as fast as possible and report achieved throughput.
+        UNCAPPED,
+    };
+}
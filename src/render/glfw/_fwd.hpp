@@ -4,5 +4,10 @@ namespace AntColony::Render::GLFW
     class GLFRameContext;
     class GLShaderProvider;
     class GLTextRenderer;
+    class GLDensityRenderer;
     class GLRenderer;
+    class GLFrameCapture;
+    class GLOffscreenTarget;
+    class GLStaticLayer;
+    class GLStreamBuffer;
 }
\ No newline at end of file
@@ -1,6 +0,0 @@
-#pragma once
-
-namespace AntColony::Render::GLFW
-{
-    constexpr auto FRAME_RATE = 1000.0f / 30.0f;
-}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "glDebugOutput.hpp"
+
+#include "../../core/logger.hpp"
+
+#include <string>
+#include "_gl.hpp"
+
+namespace AntColony::Render::GLFW
+{
+#ifndef NDEBUG
+    namespace
+    {
+        // KHR_debug tokens, not part of the GL 3.3 core header
+        constexpr const GLenum DEBUG_OUTPUT_SYNCHRONOUS = 0x8242;
+        constexpr const GLenum DEBUG_OUTPUT = 0x92E0;
+        constexpr const GLenum DEBUG_SEVERITY_HIGH = 0x9146;
+        constexpr const GLenum DEBUG_SEVERITY_MEDIUM = 0x9147;
+        constexpr const GLenum DEBUG_SEVERITY_NOTIFICATION = 0x826B;
+
+        using DebugMessageCallbackProc = void(APIENTRY *)(GLDEBUGPROC callback, const void *userParam);
+
+        void APIENTRY onDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *userParam)
+        {
+            if (severity == DEBUG_SEVERITY_NOTIFICATION)
+                return;
+
+            auto *logger = static_cast<Core::Logger *>(const_cast<void *>(userParam));
+            const auto text = "GL debug message " + std::to_string(id) + ": " + std::string(message);
+
+            if (severity == DEBUG_SEVERITY_HIGH)
+                logger->error(text);
+            else if (severity == DEBUG_SEVERITY_MEDIUM)
+                logger->warning(text);
+            else
+                logger->debug(text);
+        }
+    }
+
+    bool enableDebugOutput(const std::shared_ptr<Core::Logger> &logger)
+    {
+        // Core since GL 4.3, the extension suffix is absent for KHR_debug in core contexts
+        auto callback = reinterpret_cast<DebugMessageCallbackProc>(glfwGetProcAddress("glDebugMessageCallback"));
+        if (!callback && glfwExtensionSupported("GL_KHR_debug"))
+            callback = reinterpret_cast<DebugMessageCallbackProc>(glfwGetProcAddress("glDebugMessageCallbackKHR"));
+
+        if (!callback)
+        {
+            logger->warning("GL debug output requested but KHR_debug is not supported");
+            return false;
+        }
+
+        glEnable(DEBUG_OUTPUT);
+        // Report errors from the call that caused them, at the cost of the pipelining it disables
+        glEnable(DEBUG_OUTPUT_SYNCHRONOUS);
+        callback(onDebugMessage, logger.get());
+
+        logger->info("GL debug output enabled");
+        return true;
+    }
+#else
+    bool enableDebugOutput(const std::shared_ptr<Core::Logger> &logger)
+    {
+        logger->warning("GL debug output is compiled out of release builds");
+        return false;
+    }
+#endif
+}
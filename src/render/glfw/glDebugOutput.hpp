@@ -0,0 +1,18 @@
+#pragma once
+#include "../../core/_fwd.hpp"
+
+#include <memory>
+
+namespace AntColony::Render::GLFW
+{
+    /**
+     * @brief Routes GL errors and warnings to the logger through a KHR_debug callback.
+     *
+     * Replaces polling glGetError after draws, which forces the driver to synchronise with the GPU.
+     * Compiled out when NDEBUG is defined, the call then only logs that it is unavailable.
+     * The context must be current and should be created with GLFW_OPENGL_DEBUG_CONTEXT.
+     * @param logger Receives the messages, must outlive the context.
+     * @return True if the callback is installed.
+     */
+    bool enableDebugOutput(const std::shared_ptr<Core::Logger> &logger);
+}
@@ -0,0 +1,196 @@
+#include "glShaders.hpp"
+#include "glDensityRenderer.hpp"
+#include "glShaderProvider.hpp"
+#include "glStreamBuffer.hpp"
+
+#include "../camera.hpp"
+
+#include "../../core/logger.hpp"
+#include "../../core/color.hpp"
+#include "../../core/densityGrid.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace AntColony::Render::GLFW
+{
+    constexpr const int NUM_QUAD_VERTICES = 4;
+    // Position and texture coordinates per quad vertex
+    constexpr const GLsizeiptr QUAD_VERTEX_STRIDE = 4 * sizeof(float);
+
+    GLDensityRenderer::GLDensityRenderer(std::shared_ptr<GLShaderProvider> shaderProvider, std::shared_ptr<AntColony::Core::Logger> logger, RenderStats &stats, const Camera &camera, std::shared_ptr<GLStreamBuffer> streamBuffer)
+        : shaderProvider(shaderProvider),
+          logger(logger),
+          stats(stats),
+          camera(camera),
+          streamBuffer(streamBuffer),
+          densityShaderProgram(0),
+          coverageShaderProgram(0),
+          quadVAO(0),
+          densityTarget{0, 0, 0, 0},
+          coverageTarget{0, 0, 0, 0},
+          isInited(false) {}
+
+    GLDensityRenderer::~GLDensityRenderer()
+    {
+        isInited = false;
+        for (auto *target : {&densityTarget, &coverageTarget})
+        {
+            glDeleteTextures(1, &target->texture);
+            glDeleteBuffers(1, &target->pixelBuffer);
+        }
+        glDeleteVertexArrays(1, &quadVAO);
+        glDeleteProgram(densityShaderProgram);
+        glDeleteProgram(coverageShaderProgram);
+    }
+
+    void GLDensityRenderer::init()
+    {
+        densityShaderProgram = shaderProvider->createShaderProgram(DENSITY_VERTEX_SHADER_SOURCE, DENSITY_FRAGMENT_SHADER_SOURCE);
+        if (densityShaderProgram == 0)
+        {
+            logger->error("Failed to create density shader program");
+            return;
+        }
+
+        coverageShaderProgram = shaderProvider->createShaderProgram(DENSITY_VERTEX_SHADER_SOURCE, COVERAGE_FRAGMENT_SHADER_SOURCE);
+        if (coverageShaderProgram == 0)
+        {
+            logger->error("Failed to create coverage shader program");
+            return;
+        }
+
+        // Position and texture coordinates are written per draw from the grid area, selected by first vertex
+        glGenVertexArrays(1, &quadVAO);
+        glBindVertexArray(quadVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, streamBuffer->getBuffer());
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, QUAD_VERTEX_STRIDE, reinterpret_cast<void *>(0));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, QUAD_VERTEX_STRIDE, reinterpret_cast<void *>(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        for (auto *target : {&densityTarget, &coverageTarget})
+        {
+            glGenBuffers(1, &target->pixelBuffer);
+            glGenTextures(1, &target->texture);
+        }
+
+        isInited = true;
+        logger->debug("GLDensityRenderer initialized successfully");
+    }
+
+    void GLDensityRenderer::ensureTextureSize(GridTexture &target, int width, int height)
+    {
+        if (width == target.width && height == target.height)
+            return;
+
+        glBindTexture(GL_TEXTURE_2D, target.texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, width, height, 0, GL_RED, GL_FLOAT, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        target.width = width;
+        target.height = height;
+        logger->debug("Density texture resized to " + std::to_string(width) + "x" + std::to_string(height));
+    }
+
+    void GLDensityRenderer::uploadGrid(const GridTexture &target, const Core::DensityGrid &grid) const
+    {
+        const auto size = static_cast<GLsizeiptr>(grid.cells.size() * sizeof(float));
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, target.pixelBuffer);
+
+        // Orphan the previous storage so the driver does not wait for the last upload
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        auto *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (mapped)
+        {
+            std::memcpy(mapped, grid.cells.data(), size);
+            stats.bufferUploads++;
+            stats.uploadedBytes += size;
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+            glBindTexture(GL_TEXTURE_2D, target.texture);
+            stats.textureBinds++;
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, grid.width, grid.height, GL_RED, GL_FLOAT, reinterpret_cast<void *>(0));
+        }
+        else
+        {
+            logger->error("Failed to map density pixel buffer");
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    void GLDensityRenderer::drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawDensityGrid");
+            return;
+        }
+
+        drawGrid(grid, color, densityShaderProgram, densityTarget);
+    }
+
+    void GLDensityRenderer::drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawCoverageGrid");
+            return;
+        }
+
+        drawGrid(grid, color, coverageShaderProgram, coverageTarget);
+    }
+
+    void GLDensityRenderer::drawGrid(const Core::DensityGrid &grid, const Core::Color &color, GLuint program, GridTexture &target)
+    {
+        if (grid.width <= 0 || grid.height <= 0 || grid.maxValue <= 0.0f)
+            return;
+
+        ensureTextureSize(target, grid.width, grid.height);
+        uploadGrid(target, grid);
+
+        // Grid area is in world coordinates, mapped to the normalized [-1,1] view; row 0 of the texture at minY
+        const auto min = camera.worldToView(Core::Point(grid.area.minX, grid.area.minY));
+        const auto max = camera.worldToView(Core::Point(grid.area.maxX, grid.area.maxY));
+        const float quadVertices[] = {
+            min.x, min.y, 0.0f, 0.0f,
+            max.x, min.y, 1.0f, 0.0f,
+            min.x, max.y, 0.0f, 1.0f,
+            max.x, max.y, 1.0f, 1.0f};
+
+        const auto offset = streamBuffer->write(quadVertices, sizeof(quadVertices), QUAD_VERTEX_STRIDE);
+        if (offset < 0)
+            return;
+
+        glBindVertexArray(quadVAO);
+        stats.vertexArrayBinds++;
+
+        glUseProgram(program);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, target.texture);
+        glUniform1i(glGetUniformLocation(program, "uDensityTex"), 0);
+        glUniform1f(glGetUniformLocation(program, "uMaxDensity"), grid.maxValue);
+        glUniform3f(glGetUniformLocation(program, "uColor"), color.r, color.g, color.b);
+        stats.programBinds++;
+        stats.textureBinds++;
+        stats.uniformUploads += 3;
+
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glDrawArrays(GL_TRIANGLE_STRIP, static_cast<GLint>(offset / QUAD_VERTEX_STRIDE), NUM_QUAD_VERTICES);
+        stats.drawCalls++;
+        glDisable(GL_BLEND);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glBindVertexArray(0);
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "_fwd.hpp"
+#include "../_fwd.hpp"
+#include "../../core/_fwd.hpp"
+#include "../renderStats.hpp"
+
+#include <memory>
+#include "_gl.hpp"
+
+namespace AntColony::Render::GLFW
+{
+    /**
+     * @brief OpenGL-based renderer for density grids drawn as a single textured quad.
+     */
+    class GLDensityRenderer
+    {
+    public:
+        /**
+         * @brief Constructor initializes renderer with a shader provider and logger.
+         * @param shaderProvider Shared pointer to the shader provider instance.
+         * @param logger Shared pointer to the logger instance.
+         * @param stats Counters of the current frame, owned by the render context.
+         * @param camera Maps the grid area to the view, owned by the render context.
+         * @param streamBuffer Ring the area quads are written to every frame.
+         */
+        GLDensityRenderer(std::shared_ptr<GLShaderProvider> shaderProvider, std::shared_ptr<AntColony::Core::Logger> logger, RenderStats &stats, const Camera &camera, std::shared_ptr<GLStreamBuffer> streamBuffer);
+
+        /**
+         * @brief Destructor cleans up OpenGL resources.
+         */
+        ~GLDensityRenderer();
+
+        /**
+         * @brief Initializes shaders, quad geometry and the pixel buffer object, the stream buffer must be initialized first.
+         */
+        void init();
+
+        /**
+         * @brief Uploads the grid to the density texture and draws it over the grid area.
+         * @param grid Density values to draw.
+         * @param color RGB color of the densest cells.
+         */
+        void drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color);
+
+        /**
+         * @brief Uploads the grid to the density texture and draws it in a flat color with the cell coverage as opacity.
+         * @param grid Coverage values to draw.
+         * @param color RGB color of the covered cells.
+         */
+        void drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color);
+
+    private:
+        /**
+         * @brief Texture and pixel buffer of one kind of grid, kept apart so each keeps its own resolution.
+         */
+        struct GridTexture
+        {
+            /// @brief Pixel buffer object used to stream grid values to the texture.
+            GLuint pixelBuffer;
+            /// @brief Single-channel float texture holding the grid.
+            GLuint texture;
+            /// @brief Current texture width in cells.
+            int width;
+            /// @brief Current texture height in cells.
+            int height;
+        };
+
+        /// @brief Shared pointer to the shader provider.
+        std::shared_ptr<GLShaderProvider> shaderProvider;
+        /// @brief Shared pointer to the logger for error reporting.
+        std::shared_ptr<AntColony::Core::Logger> logger;
+        /// @brief Counters of the current frame.
+        RenderStats &stats;
+        /// @brief World to view transform.
+        const Camera &camera;
+        /// @brief Ring holding the area quads of the frames in flight.
+        std::shared_ptr<GLStreamBuffer> streamBuffer;
+        /// @brief Shader program mapping density to the colour ramp.
+        GLuint densityShaderProgram;
+        /// @brief Shader program drawing coverage as opacity.
+        GLuint coverageShaderProgram;
+        /// @brief Vertex Array Object reading area quads from the stream buffer.
+        GLuint quadVAO;
+        /// @brief Target of density grids such as the pheromone heatmap.
+        GridTexture densityTarget;
+        /// @brief Target of coverage grids such as the ant splats, usually at a different resolution.
+        GridTexture coverageTarget;
+        /// @brief Tracks initialization state.
+        bool isInited;
+
+        /**
+         * @brief Reallocates the texture of a target when the grid resolution changes.
+         * @param target Texture to resize.
+         * @param width Grid width in cells.
+         * @param height Grid height in cells.
+         */
+        void ensureTextureSize(GridTexture &target, int width, int height);
+
+        /**
+         * @brief Streams grid values through the pixel buffer object of a target into its texture.
+         * @param target Texture to upload to.
+         * @param grid Density values to upload.
+         */
+        void uploadGrid(const GridTexture &target, const Core::DensityGrid &grid) const;
+
+        /**
+         * @brief Uploads the grid to a target and draws it over its area with one of the grid programs.
+         */
+        void drawGrid(const Core::DensityGrid &grid, const Core::Color &color, GLuint program, GridTexture &target);
+    };
+}
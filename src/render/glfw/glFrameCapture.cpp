@@ -0,0 +1,148 @@
+#include "glFrameCapture.hpp"
+
+#include "../capture/frameWriter.hpp"
+#include "../../core/logger.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace AntColony::Render::GLFW
+{
+    namespace
+    {
+        constexpr const int BYTES_PER_PIXEL = 4;
+
+        // Upper bound for a blocking wait at shutdown
+        constexpr const GLuint64 FLUSH_TIMEOUT_NS = 1000000000;
+    }
+
+    GLFrameCapture::GLFrameCapture(Capture::FrameWriter &writer, std::shared_ptr<Core::Logger> logger)
+        : writer(writer),
+          logger(logger),
+          slots(),
+          head(0),
+          inFlight(0),
+          frameIndex(0),
+          droppedFrames(0),
+          sizeMismatchReported(false),
+          isInited(false) {}
+
+    GLFrameCapture::~GLFrameCapture()
+    {
+        if (!isInited)
+            return;
+
+        for (auto &slot : slots)
+        {
+            if (slot.fence)
+                glDeleteSync(slot.fence);
+            glDeleteBuffers(1, &slot.buffer);
+        }
+
+        if (droppedFrames > 0)
+            logger->warning("GL capture dropped " + std::to_string(droppedFrames) + " frames waiting for readback");
+    }
+
+    void GLFrameCapture::init()
+    {
+        const auto size = static_cast<GLsizeiptr>(writer.getWidth()) * writer.getHeight() * BYTES_PER_PIXEL;
+
+        for (auto &slot : slots)
+        {
+            glGenBuffers(1, &slot.buffer);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+            slot.fence = nullptr;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        isInited = true;
+    }
+
+    void GLFrameCapture::capture(int width, int height)
+    {
+        if (!isInited)
+            return;
+
+        collect(false);
+        const auto index = frameIndex++;
+
+        if (width != writer.getWidth() || height != writer.getHeight())
+        {
+            if (!sizeMismatchReported)
+            {
+                logger->warning("Framebuffer size differs from the capture size, frames are skipped until it matches");
+                sizeMismatchReported = true;
+            }
+            return;
+        }
+
+        if (inFlight == RING_SIZE)
+        {
+            droppedFrames++;
+            return;
+        }
+
+        auto &slot = slots[(head + inFlight) % RING_SIZE];
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast<void *>(0));
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.frameIndex = index;
+        inFlight++;
+    }
+
+    void GLFrameCapture::flush()
+    {
+        if (isInited)
+            collect(true);
+    }
+
+    void GLFrameCapture::collect(bool wait)
+    {
+        const auto size = static_cast<GLsizeiptr>(writer.getWidth()) * writer.getHeight() * BYTES_PER_PIXEL;
+
+        while (inFlight > 0)
+        {
+            auto &slot = slots[head];
+            const auto status = glClientWaitSync(slot.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? FLUSH_TIMEOUT_NS : 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            {
+                if (wait)
+                    logger->error("Timed out waiting for frame readback");
+                return;
+            }
+
+            glDeleteSync(slot.fence);
+            slot.fence = nullptr;
+
+            // A full writer pool drops the frame, the buffer is still recycled
+            auto *frame = writer.acquireFrame();
+            if (frame)
+            {
+                glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+                const auto *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+                if (mapped)
+                {
+                    std::memcpy(frame->pixels.data(), mapped, static_cast<std::size_t>(size));
+                    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+                    frame->bottomUp = true;
+                    frame->frameIndex = slot.frameIndex;
+                    writer.submitFrame(frame);
+                }
+                else
+                {
+                    logger->error("Failed to map frame readback buffer");
+                    writer.releaseFrame(frame);
+                }
+                glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            }
+
+            head = (head + 1) % RING_SIZE;
+            inFlight--;
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "_fwd.hpp"
+#include "../capture/_fwd.hpp"
+#include "../../core/_fwd.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include "_gl.hpp"
+
+namespace AntColony::Render::GLFW
+{
+    /**
+     * @brief Reads back rendered frames through a ring of pixel buffer objects.
+     *
+     * glReadPixels into a bound pack buffer returns immediately; a fence marks when the copy is done.
+     * Buffers are only mapped once their fence has signalled, so the render loop never waits on the GPU.
+     * If every buffer is still in flight the frame is dropped.
+     */
+    class GLFrameCapture
+    {
+    public:
+        /**
+         * @brief Constructor with the writer receiving completed frames and a logger.
+         * @param writer Frame writer, must outlive the capture.
+         * @param logger Shared pointer to the logger instance.
+         */
+        GLFrameCapture(Capture::FrameWriter &writer, std::shared_ptr<Core::Logger> logger);
+
+        /**
+         * @brief Destructor releases buffers and fences without waiting for them.
+         */
+        ~GLFrameCapture();
+
+        /**
+         * @brief Creates the pixel buffers, requires a current GL context.
+         */
+        void init();
+
+        /**
+         * @brief Hands finished readbacks to the writer and starts reading back the current back buffer.
+         * @param width Framebuffer width, frames not matching the writer size are skipped.
+         * @param height Framebuffer height.
+         */
+        void capture(int width, int height);
+
+        /**
+         * @brief Waits for all readbacks in flight and hands them to the writer.
+         */
+        void flush();
+
+    private:
+        static constexpr const std::size_t RING_SIZE = 3;
+
+        struct Slot
+        {
+            GLuint buffer;
+            GLsync fence;
+            std::uint64_t frameIndex;
+        };
+
+        Capture::FrameWriter &writer;
+        std::shared_ptr<Core::Logger> logger;
+
+        std::array<Slot, RING_SIZE> slots;
+        /// @brief Oldest slot in flight.
+        std::size_t head;
+        /// @brief Number of slots in flight.
+        std::size_t inFlight;
+        std::uint64_t frameIndex;
+        std::uint64_t droppedFrames;
+        bool sizeMismatchReported;
+        bool isInited;
+
+        /**
+         * @brief Hands completed readbacks to the writer in frame order.
+         * @param wait Block on fences instead of stopping at the first pending one.
+         */
+        void collect(bool wait);
+    };
+}
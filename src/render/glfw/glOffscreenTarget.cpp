@@ -0,0 +1,46 @@
+#include "glOffscreenTarget.hpp"
+
+#include "../../core/logger.hpp"
+
+#include <string>
+
+namespace AntColony::Render::GLFW
+{
+    GLOffscreenTarget::GLOffscreenTarget(std::shared_ptr<Core::Logger> logger)
+        : logger(logger),
+          framebuffer(0),
+          colorBuffer(0) {}
+
+    GLOffscreenTarget::~GLOffscreenTarget()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteRenderbuffers(1, &colorBuffer);
+        glDeleteFramebuffers(1, &framebuffer);
+    }
+
+    GLuint GLOffscreenTarget::getFramebuffer() const { return framebuffer; }
+
+    bool GLOffscreenTarget::init(int width, int height)
+    {
+        glGenRenderbuffers(1, &colorBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+
+        const auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        if (status != GL_FRAMEBUFFER_COMPLETE)
+        {
+            logger->error("Offscreen framebuffer is incomplete: " + std::to_string(status));
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            return false;
+        }
+
+        // Stays bound, every draw and readback goes to the offscreen target
+        logger->debug("Offscreen framebuffer (" + std::to_string(width) + "x" + std::to_string(height) + ") initialized");
+        return true;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "_fwd.hpp"
+#include "../../core/_fwd.hpp"
+
+#include <memory>
+#include "_gl.hpp"
+
+namespace AntColony::Render::GLFW
+{
+    /**
+     * @brief Framebuffer object replacing the default framebuffer when there is no window to present to.
+     */
+    class GLOffscreenTarget
+    {
+    public:
+        explicit GLOffscreenTarget(std::shared_ptr<Core::Logger> logger);
+
+        /**
+         * @brief Destructor releases the framebuffer, requires the GL context to still be current.
+         */
+        ~GLOffscreenTarget();
+
+        /**
+         * @brief Creates an RGBA8 colour attachment and binds the framebuffer for drawing and reading.
+         * @param width Target width in pixels.
+         * @param height Target height in pixels.
+         * @return True if the framebuffer is complete.
+         */
+        bool init(int width, int height);
+
+        GLuint getFramebuffer() const;
+
+    private:
+        std::shared_ptr<Core::Logger> logger;
+        GLuint framebuffer;
+        GLuint colorBuffer;
+    };
+}
@@ -2,11 +2,17 @@
 #include "glRenderContext.hpp"
 #include "glShaderProvider.hpp"
 #include "glfwFrameContext.hpp"
-#include "constants.hpp"
+#include "glFrameCapture.hpp"
+#include "glOffscreenTarget.hpp"
+#include "glDebugOutput.hpp"
+
+#include "../capture/frameWriter.hpp"
 
 #include "../../core/logger.hpp"
 
+#include <cmath>
 #include <string>
+#include <utility>
 
 #include <vector>
 #include <iostream>
@@ -14,89 +20,272 @@
 
 namespace AntColony::Render::GLFW
 {
+    // Zoom factor per scroll wheel step
+    constexpr const float ZOOM_STEP = 1.1f;
 
-    std::unique_ptr<RenderContext> GLRenderContext::getInstance(const std::shared_ptr<Core::Logger> logger)
+    std::unique_ptr<RenderContext> GLRenderContext::getInstance(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings)
     {
-        return std::make_unique<GLRenderContext>(GLRenderContext(logger));
+        return std::unique_ptr<RenderContext>(new GLRenderContext(logger, settings));
     }
 
-    GLRenderContext::GLRenderContext(const std::shared_ptr<Core::Logger> logger)
+    GLRenderContext::GLRenderContext(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings)
         : logger(logger),
+          settings(settings),
           isInited(false),
+          frameCount(0),
           window(nullptr),
-          renderer(std::make_shared<GLRenderer>(std::make_shared<GLShaderProvider>(logger), logger)) {}
+          isPanning(false),
+          lastCursorX(0.0),
+          lastCursorY(0.0),
+          renderer(std::make_shared<GLRenderer>(std::make_shared<GLShaderProvider>(logger), logger, frameStats, camera)),
+          pacer(std::make_unique<FramePacer>(settings, logger)),
+          frameContext(*renderer, lastFrameStats, camera) {}
 
     void GLRenderContext::init()
     {
+#ifdef GLFW_PLATFORM_NULL
+        // GLFW 3.4+: the null platform needs no display server, EGL or OSMesa provide the context
+        if (settings.offscreen)
+            glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
+
         if (!glfwInit())
         {
             logger->error("Failed to initialize GLFW");
-            window = nullptr;
+            return;
         }
 
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
         logger->debug("GLFW initialized");
 
-        const auto *title = "Ant Colony Simulation";
-        const auto windowWidth = 720;
-        const auto windowHeight = 720;
-
-        auto *w = glfwCreateWindow(windowWidth, windowHeight, title, NULL, NULL);
+        auto *w = createWindow();
         if (!w)
         {
             logger->error("Failed to create GLFW window");
             glfwTerminate();
+            return;
         }
 
-        // Enforce square zone
-        glfwSetWindowAspectRatio(w, 1, 1);
-
-        logger->debug("GLFW Window (Title: '" +
-                      std::string(title) + "', " +
-                      std::to_string(windowWidth) + "x" +
-                      std::to_string(windowHeight) +
-                      ") initialized");
-
         // Make the window's context current
         glfwMakeContextCurrent(w);
+        window = w;
 
         // Initialize GLAD
         if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
         {
             logger->error("Failed to initialize GLAD");
-            glfwTerminate();
-            window = nullptr;
             return;
         }
 
+        if (settings.debugOutput)
+            enableDebugOutput(logger);
+
+        if (settings.offscreen)
+        {
+            offscreenTarget = std::make_unique<GLOffscreenTarget>(logger);
+            if (!offscreenTarget->init(settings.width, settings.height))
+                return;
+            renderer->setTargetFramebuffer(offscreenTarget->getFramebuffer());
+
+            logger->info("Offscreen GL renderer: " + std::string(reinterpret_cast<const char *>(glGetString(GL_RENDERER))));
+        }
+        else
+        {
+            // Enforce square zone
+            glfwSetWindowAspectRatio(w, 1, 1);
+
+            // Only VSYNC pacing lets the swap wait for the display, other modes are paced by FramePacer
+            glfwSwapInterval(settings.pacing == VSYNC ? 1 : 0);
+
+            // Set callback for window resize
+            glfwSetFramebufferSizeCallback(w, framebufferSizeCallback);
+
+            // Scroll zooms at the cursor, dragging with the left button pans, R resets the camera
+            glfwSetWindowUserPointer(w, this);
+            glfwSetScrollCallback(w, scrollCallback);
+            glfwSetMouseButtonCallback(w, mouseButtonCallback);
+            glfwSetCursorPosCallback(w, cursorPosCallback);
+            glfwSetKeyCallback(w, keyCallback);
+        }
+
         // Set viewport
-        glViewport(0, 0, windowWidth, windowHeight);
+        glViewport(0, 0, settings.width, settings.height);
 
-        // Set callback for window resize
-        glfwSetFramebufferSizeCallback(w, framebufferSizeCallback);
-        window = w;
+        renderer->setCircleRenderMode(settings.circleMode);
         renderer->init();
+
+        frameWriter = Capture::FrameWriter::create(settings, logger);
+        if (frameWriter)
+        {
+            frameCapture = std::make_unique<GLFrameCapture>(*frameWriter, logger);
+            frameCapture->init();
+        }
+
+        pacer->reset();
         isInited = true;
     }
 
+    GLFWwindow *GLRenderContext::createWindow() const
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifndef NDEBUG
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, settings.debugOutput ? GLFW_TRUE : GLFW_FALSE);
+#endif
+
+        const auto *title = "Ant Colony Simulation";
+        const auto windowWidth = settings.width;
+        const auto windowHeight = settings.height;
+
+        if (!settings.offscreen)
+        {
+            auto *w = glfwCreateWindow(windowWidth, windowHeight, title, NULL, NULL);
+            if (w)
+            {
+                logger->debug("GLFW Window (Title: '" +
+                              std::string(title) + "', " +
+                              std::to_string(windowWidth) + "x" +
+                              std::to_string(windowHeight) +
+                              ") initialized");
+            }
+            return w;
+        }
+
+        // The window only carries the context, frames go to the offscreen framebuffer
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+        // Surfaceless EGL first, Mesa picks llvmpipe when there is no GPU; OSMesa as the fallback
+        const std::pair<int, const char *> contextApis[] = {
+            {GLFW_EGL_CONTEXT_API, "EGL"},
+            {GLFW_OSMESA_CONTEXT_API, "OSMesa"}};
+
+        for (const auto &[api, name] : contextApis)
+        {
+            glfwWindowHint(GLFW_CONTEXT_CREATION_API, api);
+            auto *w = glfwCreateWindow(windowWidth, windowHeight, title, NULL, NULL);
+            if (w)
+            {
+                logger->debug(std::string("Offscreen ") + name + " context initialized");
+                return w;
+            }
+            logger->warning(std::string("Failed to create offscreen ") + name + " context");
+        }
+
+        return nullptr;
+    }
+
     bool GLRenderContext::getInited() const { return isInited; }
-    bool GLRenderContext::shouldClose() const { return glfwWindowShouldClose(window); }
+    bool GLRenderContext::shouldClose() const
+    {
+        return glfwWindowShouldClose(window) || (settings.frameLimit > 0 && frameCount >= settings.frameLimit);
+    }
 
     void GLRenderContext::framebufferSizeCallback(GLFWwindow *window, int width, int height)
     {
         glViewport(0, 0, width, height);
     }
 
-    std::unique_ptr<FrameContext> GLRenderContext::getFrameContext() const
+    Core::Point GLRenderContext::cursorToView(double x, double y) const
+    {
+        int width, height;
+        glfwGetWindowSize(window, &width, &height);
+        if (width <= 0 || height <= 0)
+            return Core::Point(0.0f, 0.0f);
+
+        return Core::Point(static_cast<float>(2.0 * x / width - 1.0), static_cast<float>(1.0 - 2.0 * y / height));
+    }
+
+    void GLRenderContext::scrollCallback(GLFWwindow *window, double xOffset, double yOffset)
+    {
+        auto *ctx = static_cast<GLRenderContext *>(glfwGetWindowUserPointer(window));
+
+        double x, y;
+        glfwGetCursorPos(window, &x, &y);
+        ctx->camera.zoomAt(std::pow(ZOOM_STEP, static_cast<float>(yOffset)), ctx->cursorToView(x, y));
+    }
+
+    void GLRenderContext::mouseButtonCallback(GLFWwindow *window, int button, int action, int mods)
+    {
+        if (button != GLFW_MOUSE_BUTTON_LEFT)
+            return;
+
+        auto *ctx = static_cast<GLRenderContext *>(glfwGetWindowUserPointer(window));
+        ctx->isPanning = action == GLFW_PRESS;
+        glfwGetCursorPos(window, &ctx->lastCursorX, &ctx->lastCursorY);
+    }
+
+    void GLRenderContext::cursorPosCallback(GLFWwindow *window, double x, double y)
+    {
+        auto *ctx = static_cast<GLRenderContext *>(glfwGetWindowUserPointer(window));
+        if (!ctx->isPanning)
+            return;
+
+        const auto delta = ctx->cursorToView(x, y) - ctx->cursorToView(ctx->lastCursorX, ctx->lastCursorY);
+        ctx->camera.pan(delta);
+        ctx->lastCursorX = x;
+        ctx->lastCursorY = y;
+    }
+
+    void GLRenderContext::keyCallback(GLFWwindow *window, int key, int scancode, int action, int mods)
     {
-        return std::make_unique<GLFWFrameContext>(window, FRAME_RATE, renderer);
+        if (key == GLFW_KEY_R && action == GLFW_PRESS)
+            static_cast<GLRenderContext *>(glfwGetWindowUserPointer(window))->camera.reset();
+    }
+
+    FrameContext &GLRenderContext::beginFrame()
+    {
+        frameStart = std::chrono::steady_clock::now();
+        frameStats = RenderStats{};
+
+        int width, height;
+        glfwGetFramebufferSize(window, &width, &height);
+        camera.setViewportSize(width, height);
+
+        glClear(GL_COLOR_BUFFER_BIT);
+        return frameContext;
+    }
+
+    void GLRenderContext::endFrame()
+    {
+        frameStats.submitTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        renderer->endFrame();
+
+        // Back buffer contents are undefined after the swap, so the readback is queued first
+        if (frameCapture)
+        {
+            int width, height;
+            glfwGetFramebufferSize(window, &width, &height);
+            frameCapture->capture(width, height);
+        }
+
+        if (offscreenTarget)
+        {
+            // Nothing to present, wait for the frame so its time includes the rasterisation
+            glFinish();
+        }
+        else
+        {
+            glfwSwapBuffers(window);
+        }
+
+        frameStats.frameTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        lastFrameStats = frameStats;
+
+        glfwPollEvents();
+        frameCount++;
+        pacer->waitForNextFrame();
     }
 
     GLRenderContext::~GLRenderContext()
     {
+        // Readback, offscreen and renderer objects belong to the GL context, release them while it is alive
+        if (frameCapture)
+            frameCapture->flush();
+        frameCapture.reset();
+        frameWriter.reset();
+        renderer.reset();
+        offscreenTarget.reset();
+
         glfwDestroyWindow(window);
         glfwTerminate();
     }
@@ -1,9 +1,16 @@
 #pragma once
 #include "_fwd.hpp"
+#include "../capture/_fwd.hpp"
 #include "../../core/_fwd.hpp"
 
 #include "../renderContext.hpp"
+#include "../renderSettings.hpp"
+#include "../framePacer.hpp"
+#include "../renderStats.hpp"
+#include "../camera.hpp"
+#include "glfwFrameContext.hpp"
 
+#include <chrono>
 #include <memory>
 #include "_gl.hpp"
 
@@ -13,7 +20,7 @@ namespace AntColony::Render::GLFW
     {
     public:
 
-        static std::unique_ptr<RenderContext> getInstance(const std::shared_ptr<Core::Logger> logger);
+        static std::unique_ptr<RenderContext> getInstance(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings);
 
         ~GLRenderContext() override;
 
@@ -21,16 +28,53 @@ namespace AntColony::Render::GLFW
         void init() override;
         bool getInited() const override;
         bool shouldClose() const override;
-        std::unique_ptr<FrameContext> getFrameContext() const override;
+        FrameContext &beginFrame() override;
+        void endFrame() override;
 
     private:
-        explicit GLRenderContext(const std::shared_ptr<Core::Logger> logger);
+        GLRenderContext(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings);
         const std::shared_ptr<Core::Logger> logger;
+        const RenderSettings settings;
 
         bool isInited;
+        int frameCount;
         GLFWwindow *window;
-        const std::shared_ptr<GLRenderer> renderer;
+        /// @brief Counters of the frame being rendered.
+        RenderStats frameStats;
+        /// @brief Counters of the last completed frame, exposed through the frame context.
+        RenderStats lastFrameStats;
+        std::chrono::steady_clock::time_point frameStart;
+        /// @brief World to view transform, moved with the mouse.
+        Camera camera;
+        /// @brief Whether the left mouse button is held to pan the camera.
+        bool isPanning;
+        double lastCursorX;
+        double lastCursorY;
+        /// @brief Owns the programs, buffers and textures of the context, released before the window.
+        std::shared_ptr<GLRenderer> renderer;
+        const std::unique_ptr<FramePacer> pacer;
+        GLFWFrameContext frameContext;
+        /// @brief Encodes captured frames, null when capture is disabled.
+        std::unique_ptr<Capture::FrameWriter> frameWriter;
+        /// @brief Asynchronous readback feeding frameWriter.
+        std::unique_ptr<GLFrameCapture> frameCapture;
+        /// @brief Render target replacing the window's framebuffer in offscreen mode.
+        std::unique_ptr<GLOffscreenTarget> offscreenTarget;
+
+        /**
+         * @brief Creates the window, or a hidden one with an EGL or OSMesa context in offscreen mode.
+         */
+        GLFWwindow *createWindow() const;
+
+        /**
+         * @brief Converts a cursor position in window coordinates to normalized view coordinates.
+         */
+        Core::Point cursorToView(double x, double y) const;
 
         static void framebufferSizeCallback(GLFWwindow *window, int width, int height);
+        static void scrollCallback(GLFWwindow *window, double xOffset, double yOffset);
+        static void mouseButtonCallback(GLFWwindow *window, int button, int action, int mods);
+        static void cursorPosCallback(GLFWwindow *window, double x, double y);
+        static void keyCallback(GLFWwindow *window, int key, int scancode, int action, int mods);
     };
 }
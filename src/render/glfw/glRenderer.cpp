@@ -1,10 +1,14 @@
-#include "text/_fonts.hpp"
 #include "text/font.hpp"
 
 #include "glShaders.hpp"
 #include "glRenderer.hpp"
 #include "glShaderProvider.hpp"
 #include "glTextRenderer.hpp"
+#include "glDensityRenderer.hpp"
+#include "glStaticLayer.hpp"
+#include "glStreamBuffer.hpp"
+
+#include "../camera.hpp"
 
 #include "../../core/logger.hpp"
 #include "../../core/point.hpp"
@@ -19,11 +23,26 @@
 namespace AntColony::Render::GLFW
 {
     constexpr const int NUM_CIRCLE_SEGMENTS = 50;
+    constexpr const int NUM_QUAD_VERTICES = 4;
+
+    // Extra pixels around a quad circle so the anti-aliased edge is not clipped
+    constexpr const float CIRCLE_AA_MARGIN = 1.0f;
+
+    // Initial stream buffer bytes per frame, enough for the HUD text and a few grid quads
+    constexpr const GLsizeiptr STREAM_REGION_SIZE = 64 * 1024;
 
-    GLRenderer::GLRenderer(const std::shared_ptr<GLShaderProvider> shaderProvider, const std::shared_ptr<AntColony::Core::Logger> logger)
+    GLRenderer::GLRenderer(const std::shared_ptr<GLShaderProvider> shaderProvider, const std::shared_ptr<AntColony::Core::Logger> logger, RenderStats &stats, const Camera &camera)
         : shaderProvider(shaderProvider),
           logger(logger),
-          textRenderer(std::make_shared<GLTextRenderer>(shaderProvider, logger)),
+          stats(stats),
+          camera(camera),
+          staticLayerCameraRevision(camera.getRevision()),
+          streamBuffer(std::make_shared<GLStreamBuffer>(logger, stats, STREAM_REGION_SIZE)),
+          textRenderer(std::make_shared<GLTextRenderer>(shaderProvider, logger, stats, streamBuffer)),
+          densityRenderer(std::make_shared<GLDensityRenderer>(shaderProvider, logger, stats, camera, streamBuffer)),
+          staticLayer(std::make_shared<GLStaticLayer>(logger, stats)),
+          targetFramebuffer(0),
+          circleRenderMode(SDF_QUAD),
           isInited(false) {}
 
     GLRenderer::~GLRenderer()
@@ -31,6 +50,9 @@ namespace AntColony::Render::GLFW
         isInited = false;
         glDeleteBuffers(1, &circleVBO);
         glDeleteVertexArrays(1, &circleVAO);
+        glDeleteBuffers(1, &quadVBO);
+        glDeleteVertexArrays(1, &quadVAO);
+        glDeleteProgram(circleShaderProgram);
         glDeleteProgram(figureShaderProgram);
         glDeleteProgram(textShaderProgram);
     }
@@ -52,8 +74,20 @@ namespace AntColony::Render::GLFW
             return;
         }
 
+        circleShaderProgram = shaderProvider->createShaderProgram(CIRCLE_VERTEX_SHADER_SOURCE, CIRCLE_FRAGMENT_SHADER_SOURCE);
+        if (circleShaderProgram == 0)
+        {
+            logger->error("Failed to create circle shader program");
+            glDeleteProgram(figureShaderProgram);
+            glDeleteProgram(textShaderProgram);
+            return;
+        }
+
         initCircleGeometry();
+        initQuadGeometry();
+        streamBuffer->init();
         textRenderer->init();
+        densityRenderer->init();
         isInited = true;
 
         // Log viewport
@@ -92,6 +126,34 @@ namespace AntColony::Render::GLFW
         glBindVertexArray(0);
     }
 
+    void GLRenderer::initQuadGeometry()
+    {
+        // Unit quad as a triangle strip, covers [-1, 1] in both axes
+        const float quadVertices[] = {
+            -1.0f, -1.0f,
+            1.0f, -1.0f,
+            -1.0f, 1.0f,
+            1.0f, 1.0f};
+
+        glGenVertexArrays(1, &quadVAO);
+        glGenBuffers(1, &quadVBO);
+        glBindVertexArray(quadVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+
+    void GLRenderer::endFrame()
+    {
+        if (isInited)
+            streamBuffer->endFrame();
+    }
+
+    void GLRenderer::setCircleRenderMode(CIRCLE_RENDER_MODE mode) { circleRenderMode = mode; }
+
     void GLRenderer::drawCircleInPosition(const Core::Point &position, const float radius, const Core::Color &color)
     {
         if (!isInited)
@@ -103,30 +165,76 @@ namespace AntColony::Render::GLFW
         int winWidth, winHeight;
         glfwGetFramebufferSize(glfwGetCurrentContext(), &winWidth, &winHeight);
 
-        // Convert from normalized [-1,1] to pixel coordinates
-        float pixel_x = (position.x + 1.0f) * 0.5f * winWidth;
-        float pixel_y = (1.0f - position.y) * 0.5f * winHeight;
+        // Convert from world to normalized [-1,1] view and then to pixel coordinates
+        const auto viewPosition = camera.worldToView(position);
+        float pixel_x = (viewPosition.x + 1.0f) * 0.5f * winWidth;
+        float pixel_y = (1.0f - viewPosition.y) * 0.5f * winHeight;
 
         // Scale radius consistently with NDC space
         // In NDC, the range is 2.0 (-1 to 1), so we multiply by the dimension/2
-        float pixel_radius = radius * (std::min(winWidth, winHeight) / 2.0f);
+        float pixel_radius = camera.worldToView(radius) * (std::min(winWidth, winHeight) / 2.0f);
 
-        glUseProgram(figureShaderProgram);
         auto ortho = glm::ortho(0.0f, (float)winWidth, (float)winHeight, 0.0f);
+
+        if (circleRenderMode == SDF_QUAD)
+            drawCircleQuad(pixel_x, pixel_y, pixel_radius, color, ortho);
+        else
+            drawCircleFan(pixel_x, pixel_y, pixel_radius, color, ortho);
+    }
+
+    void GLRenderer::drawCircleFan(float pixel_x, float pixel_y, float pixel_radius, const Core::Color &color, const glm::mat4 &ortho) const
+    {
+        glUseProgram(figureShaderProgram);
         glUniformMatrix4fv(glGetUniformLocation(figureShaderProgram, "uOrtho"), 1, GL_FALSE, &ortho[0][0]);
         glUniform3f(glGetUniformLocation(figureShaderProgram, "uColor"), color.r, color.g, color.b);
+        stats.programBinds++;
 
         // Position and scale the circle
         glm::mat4 model = glm::mat4(1.0f);
         model = glm::translate(model, glm::vec3(pixel_x, pixel_y, 0.0f));
         model = glm::scale(model, glm::vec3(pixel_radius, pixel_radius, 1.0f));
         glUniformMatrix4fv(glGetUniformLocation(figureShaderProgram, "uModel"), 1, GL_FALSE, &model[0][0]);
+        stats.uniformUploads += 3;
 
         glBindVertexArray(circleVAO);
         glDrawArrays(GL_TRIANGLE_FAN, 0, NUM_CIRCLE_SEGMENTS + 2);
+        stats.vertexArrayBinds++;
+        stats.drawCalls++;
         glBindVertexArray(0);
     }
 
+    void GLRenderer::drawCircleQuad(float pixel_x, float pixel_y, float pixel_radius, const Core::Color &color, const glm::mat4 &ortho) const
+    {
+        if (pixel_radius <= 0.0f)
+            return;
+
+        const auto quadRadius = pixel_radius + CIRCLE_AA_MARGIN;
+
+        glUseProgram(circleShaderProgram);
+        stats.programBinds++;
+        glUniformMatrix4fv(glGetUniformLocation(circleShaderProgram, "uOrtho"), 1, GL_FALSE, &ortho[0][0]);
+        glUniform3f(glGetUniformLocation(circleShaderProgram, "uColor"), color.r, color.g, color.b);
+        glUniform1f(glGetUniformLocation(circleShaderProgram, "uQuadScale"), quadRadius / pixel_radius);
+
+        glm::mat4 model = glm::mat4(1.0f);
+        model = glm::translate(model, glm::vec3(pixel_x, pixel_y, 0.0f));
+        model = glm::scale(model, glm::vec3(quadRadius, quadRadius, 1.0f));
+        glUniformMatrix4fv(glGetUniformLocation(circleShaderProgram, "uModel"), 1, GL_FALSE, &model[0][0]);
+        stats.uniformUploads += 4;
+
+        // Edge coverage is written to alpha
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        glBindVertexArray(quadVAO);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, NUM_QUAD_VERTICES);
+        stats.vertexArrayBinds++;
+        stats.drawCalls++;
+        glBindVertexArray(0);
+
+        glDisable(GL_BLEND);
+    }
+
     void GLRenderer::drawText(const Core::Point &position, const std::string &text, const Core::Color &color, const float fontSize)
     {
         if (!isInited)
@@ -137,4 +245,58 @@ namespace AntColony::Render::GLFW
 
         textRenderer->drawText(position, text, color, fontSize);
     }
+
+    void GLRenderer::drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawDensityGrid");
+            return;
+        }
+
+        densityRenderer->drawDensityGrid(grid, color);
+    }
+
+    void GLRenderer::drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawCoverageGrid");
+            return;
+        }
+
+        densityRenderer->drawCoverageGrid(grid, color);
+    }
+
+    bool GLRenderer::beginStaticLayer()
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping beginStaticLayer");
+            return false;
+        }
+
+        // The layer holds world geometry, a moved camera changes its contents
+        if (camera.getRevision() != staticLayerCameraRevision)
+        {
+            staticLayer->invalidate();
+            staticLayerCameraRevision = camera.getRevision();
+        }
+
+        int winWidth, winHeight;
+        glfwGetFramebufferSize(glfwGetCurrentContext(), &winWidth, &winHeight);
+        return staticLayer->begin(winWidth, winHeight, targetFramebuffer);
+    }
+
+    void GLRenderer::endStaticLayer()
+    {
+        if (!isInited)
+            return;
+
+        staticLayer->end();
+    }
+
+    void GLRenderer::invalidateStaticLayer() { staticLayer->invalidate(); }
+
+    void GLRenderer::setTargetFramebuffer(GLuint framebuffer) { targetFramebuffer = framebuffer; }
 }
\ No newline at end of file
@@ -1,14 +1,20 @@
 #pragma once
 #include "_fwd.hpp"
+#include "../_fwd.hpp"
 #include "text/_fwd.hpp"
 #include "../../core/_fwd.hpp"
 
 #include "../renderer.hpp"
+#include "../renderStats.hpp"
+#include "../circleRenderMode.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include "_gl.hpp"
 
+#include <glm/glm.hpp>
+
 namespace AntColony::Render::GLFW
 {
     /**
@@ -21,8 +27,10 @@ namespace AntColony::Render::GLFW
          * @brief Constructor initializes renderer with a shader provider and logger.
          * @param shaderProvider Shared pointer to the shader provider instance.
          * @param logger Shared pointer to the logger instance.
+         * @param stats Counters of the current frame, owned by the render context.
+         * @param camera Maps world positions to the view, owned by the render context.
          */
-        explicit GLRenderer(const std::shared_ptr<GLShaderProvider> shaderProvider, const std::shared_ptr<AntColony::Core::Logger> logger);
+        GLRenderer(const std::shared_ptr<GLShaderProvider> shaderProvider, const std::shared_ptr<AntColony::Core::Logger> logger, RenderStats &stats, const Camera &camera);
 
         /**
          * @brief Destructor cleans up OpenGL resources.
@@ -36,28 +44,80 @@ namespace AntColony::Render::GLFW
 
         /**
          * @brief Draws a circle at the specified position with given radius and color.
-         * @param position Center point of the circle.
-         * @param radius Radius of the circle.
+         * @param position Center point of the circle in world coordinates.
+         * @param radius Radius of the circle in world units.
          * @param color RGB color of the circle.
          */
         void drawCircleInPosition(const Core::Point &position, const float radius, const Core::Color &color) override;
 
         /**
          * @brief Draws text at the specified position with given color.
-         * @param position Top-left position for text rendering.
+         * @param position Top-left position for text rendering in view coordinates, not moved by the camera.
          * @param text String to render.
          * @param color RGB color of the text.
          * @param fontSize Size of the font.
          */
         void drawText(const Core::Point &position, const std::string &text, const Core::Color &color, const float fontSize) override;
 
+        /**
+         * @brief Draws a density grid as a single textured quad.
+         * @param grid Density values to draw.
+         * @param color RGB color of the densest cells.
+         */
+        void drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color) override;
+        void drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color) override;
+
+        /**
+         * @brief Redraws the static layer texture only when it is invalid or the framebuffer was resized.
+         * @return True if the layer has to be redrawn.
+         */
+        bool beginStaticLayer() override;
+
+        /**
+         * @brief Blits the static layer texture into the frame.
+         */
+        void endStaticLayer() override;
+
+        void invalidateStaticLayer() override;
+
+        /**
+         * @brief Ends the submission of a frame, fencing the dynamic vertex data it wrote.
+         */
+        void endFrame();
+
+        /**
+         * @brief Sets the framebuffer frames are drawn to, restored after drawing the static layer.
+         * @param framebuffer Framebuffer object, 0 for the window.
+         */
+        void setTargetFramebuffer(GLuint framebuffer);
+
+        /**
+         * @brief Selects how circles are rasterised.
+         * @param mode Triangle fan or distance-shaded quad.
+         */
+        void setCircleRenderMode(CIRCLE_RENDER_MODE mode);
+
     private:
         /// @brief Shared pointer to the shader provider.
         const std::shared_ptr<GLShaderProvider> shaderProvider;
         /// @brief Shared pointer to the logger for error reporting.
         const std::shared_ptr<AntColony::Core::Logger> logger;
+        /// @brief Counters of the current frame.
+        RenderStats &stats;
+        /// @brief World to view transform.
+        const Camera &camera;
+        /// @brief Camera revision the static layer was drawn with.
+        std::uint32_t staticLayerCameraRevision;
+        /// @brief Ring for vertex data written every frame, shared by the text and density renderers.
+        const std::shared_ptr<GLStreamBuffer> streamBuffer;
         /// @brief Shared pointer to the text renderer.
         const std::shared_ptr<GLTextRenderer> textRenderer;
+        /// @brief Shared pointer to the density grid renderer.
+        const std::shared_ptr<GLDensityRenderer> densityRenderer;
+        /// @brief Shared pointer to the cached static layer.
+        const std::shared_ptr<GLStaticLayer> staticLayer;
+        /// @brief Framebuffer frames are drawn to, 0 for the window.
+        GLuint targetFramebuffer;
         /// @brief Shader program for rendering shapes (circles, frames).
         GLuint figureShaderProgram;
         /// @brief Shader program for rendering text.
@@ -66,6 +126,14 @@ namespace AntColony::Render::GLFW
         GLuint circleVAO;
         /// @brief Vertex Buffer Object for circle geometry.
         GLuint circleVBO;
+        /// @brief Shader program for distance-shaded circle quads.
+        GLuint circleShaderProgram;
+        /// @brief Vertex Array Object for the unit quad.
+        GLuint quadVAO;
+        /// @brief Vertex Buffer Object for the unit quad.
+        GLuint quadVBO;
+        /// @brief Active circle rasterisation mode.
+        CIRCLE_RENDER_MODE circleRenderMode;
         /// @brief Tracks initialization state.
         bool isInited;
 
@@ -73,5 +141,20 @@ namespace AntColony::Render::GLFW
          * @brief Precomputes circle geometry using a triangle fan.
          */
         void initCircleGeometry();
+
+        /**
+         * @brief Creates the unit quad used by distance-shaded circles.
+         */
+        void initQuadGeometry();
+
+        /**
+         * @brief Draws a circle as a tessellated triangle fan.
+         */
+        void drawCircleFan(float pixel_x, float pixel_y, float pixel_radius, const Core::Color &color, const glm::mat4 &ortho) const;
+
+        /**
+         * @brief Draws a circle as a quad shaded with an analytic distance test.
+         */
+        void drawCircleQuad(float pixel_x, float pixel_y, float pixel_radius, const Core::Color &color, const glm::mat4 &ortho) const;
     };
 }
\ No newline at end of file
@@ -37,9 +37,84 @@ namespace AntColony::Render::GLFW
         out vec4 FragColor;
         uniform sampler2D uFontTex;
         uniform vec3 uColor;
+        const float EDGE = 0.5;  // Distance field value on the glyph outline
         void main() {
-            float alpha = texture(uFontTex, TexCoord).r;
+            float dist = texture(uFontTex, TexCoord).r;
+            float smoothing = fwidth(dist);
+            float alpha = smoothstep(EDGE - smoothing, EDGE + smoothing, dist);
             FragColor = vec4(uColor, alpha);
         }
     )";
+
+    const char *CIRCLE_VERTEX_SHADER_SOURCE = R"(
+        #version 330 core
+        layout(location = 0) in vec2 aPos;
+        out vec2 LocalPos;
+        uniform mat4 uOrtho;
+        uniform mat4 uModel;
+        uniform float uQuadScale;  // Quad extent relative to the radius, leaves room for the anti-aliased edge
+        void main() {
+            LocalPos = aPos * uQuadScale;
+            gl_Position = uOrtho * uModel * vec4(aPos, 0.0, 1.0);
+        }
+    )";
+
+    const char *CIRCLE_FRAGMENT_SHADER_SOURCE = R"(
+        #version 330 core
+        in vec2 LocalPos;
+        out vec4 FragColor;
+        uniform vec3 uColor;
+        void main() {
+            float dist = length(LocalPos);
+            float smoothing = fwidth(dist);
+            float alpha = 1.0 - smoothstep(1.0 - smoothing, 1.0, dist);
+            if (alpha <= 0.0)
+                discard;
+            FragColor = vec4(uColor, alpha);
+        }
+    )";
+
+    const char *DENSITY_VERTEX_SHADER_SOURCE = R"(
+        #version 330 core
+        layout(location = 0) in vec2 aPos;
+        layout(location = 1) in vec2 aTexCoord;
+        out vec2 TexCoord;
+        void main() {
+            gl_Position = vec4(aPos, 0.0, 1.0);
+            TexCoord = aTexCoord;
+        }
+    )";
+
+    const char *DENSITY_FRAGMENT_SHADER_SOURCE = R"(
+        #version 330 core
+        in vec2 TexCoord;
+        out vec4 FragColor;
+        uniform sampler2D uDensityTex;
+        uniform float uMaxDensity;
+        uniform vec3 uColor;
+        void main() {
+            float density = clamp(texture(uDensityTex, TexCoord).r / uMaxDensity, 0.0, 1.0);
+            if (density <= 0.0)
+                discard;
+            float level = sqrt(density);  // Lift sparse trails
+            vec3 ramp = mix(uColor * 0.4, uColor, smoothstep(0.0, 0.6, level));
+            ramp = mix(ramp, vec3(1.0), smoothstep(0.6, 1.0, level));
+            FragColor = vec4(ramp, smoothstep(0.0, 0.2, level));
+        }
+    )";
+
+    const char *COVERAGE_FRAGMENT_SHADER_SOURCE = R"(
+        #version 330 core
+        in vec2 TexCoord;
+        out vec4 FragColor;
+        uniform sampler2D uDensityTex;
+        uniform float uMaxDensity;
+        uniform vec3 uColor;
+        void main() {
+            float coverage = clamp(texture(uDensityTex, TexCoord).r / uMaxDensity, 0.0, 1.0);
+            if (coverage <= 0.0)
+                discard;
+            FragColor = vec4(uColor, coverage);
+        }
+    )";
 }
\ No newline at end of file
@@ -6,4 +6,9 @@ namespace AntColony::Render::GLFW
     extern const char *FRAGMENT_SHADER_SOURCE;
     extern const char *TEXT_VERTEX_SHADER_SOURCE;
     extern const char *TEXT_FRAGMENT_SHADER_SOURCE;
+    extern const char *CIRCLE_VERTEX_SHADER_SOURCE;
+    extern const char *CIRCLE_FRAGMENT_SHADER_SOURCE;
+    extern const char *DENSITY_VERTEX_SHADER_SOURCE;
+    extern const char *DENSITY_FRAGMENT_SHADER_SOURCE;
+    extern const char *COVERAGE_FRAGMENT_SHADER_SOURCE;
 }
\ No newline at end of file
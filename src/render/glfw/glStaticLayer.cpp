@@ -0,0 +1,102 @@
+#include "glStaticLayer.hpp"
+
+#include "../../core/logger.hpp"
+
+#include <string>
+
+namespace AntColony::Render::GLFW
+{
+    GLStaticLayer::GLStaticLayer(std::shared_ptr<Core::Logger> logger, RenderStats &stats)
+        : logger(logger),
+          stats(stats),
+          framebuffer(0),
+          texture(0),
+          targetFramebuffer(0),
+          width(0),
+          height(0),
+          isValid(false) {}
+
+    GLStaticLayer::~GLStaticLayer()
+    {
+        glDeleteTextures(1, &texture);
+        glDeleteFramebuffers(1, &framebuffer);
+    }
+
+    bool GLStaticLayer::resize(int newWidth, int newHeight)
+    {
+        if (framebuffer == 0)
+        {
+            glGenFramebuffers(1, &framebuffer);
+            glGenTextures(1, &texture);
+        }
+
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, newWidth, newHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+
+        const auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        if (status != GL_FRAMEBUFFER_COMPLETE)
+        {
+            logger->error("Static layer framebuffer is incomplete: " + std::to_string(status));
+            return false;
+        }
+
+        width = newWidth;
+        height = newHeight;
+        logger->debug("Static layer resized to " + std::to_string(width) + "x" + std::to_string(height));
+        return true;
+    }
+
+    bool GLStaticLayer::begin(int targetWidth, int targetHeight, GLuint target)
+    {
+        targetFramebuffer = target;
+
+        if (isValid && targetWidth == width && targetHeight == height)
+            return false;
+
+        isValid = false;
+        if (targetWidth != width || targetHeight != height || framebuffer == 0)
+        {
+            if (!resize(targetWidth, targetHeight))
+            {
+                // Draw straight into the frame, the layer is retried next frame
+                glBindFramebuffer(GL_FRAMEBUFFER, targetFramebuffer);
+                width = height = 0;
+                return true;
+            }
+        }
+        else
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        }
+
+        // Same clear colour as the frame, so the blit also replaces the frame clear
+        glClear(GL_COLOR_BUFFER_BIT);
+        isValid = true;
+        return true;
+    }
+
+    void GLStaticLayer::end()
+    {
+        if (!isValid)
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, targetFramebuffer);
+            return;
+        }
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, targetFramebuffer);
+        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, targetFramebuffer);
+
+        // A full-screen copy, counted like a draw
+        stats.drawCalls++;
+    }
+
+    void GLStaticLayer::invalidate() { isValid = false; }
+}
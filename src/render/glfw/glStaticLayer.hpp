@@ -0,0 +1,66 @@
+#pragma once
+#include "_fwd.hpp"
+#include "../../core/_fwd.hpp"
+
+#include "../renderStats.hpp"
+
+#include <memory>
+#include "_gl.hpp"
+
+namespace AntColony::Render::GLFW
+{
+    /**
+     * @brief Geometry that rarely changes, rendered once into a framebuffer texture and blitted every frame.
+     */
+    class GLStaticLayer
+    {
+    public:
+        /**
+         * @brief Constructor with logger and the frame counters.
+         * @param logger Shared pointer to the logger instance.
+         * @param stats Counters of the current frame, owned by the render context.
+         */
+        GLStaticLayer(std::shared_ptr<Core::Logger> logger, RenderStats &stats);
+
+        /**
+         * @brief Destructor releases the layer, requires the GL context to still be current.
+         */
+        ~GLStaticLayer();
+
+        /**
+         * @brief Checks the cached layer against the target size.
+         * @param width Target width in pixels.
+         * @param height Target height in pixels.
+         * @param targetFramebuffer Framebuffer the frame is drawn to, 0 for the window.
+         * @return True if the layer has to be redrawn, its framebuffer is then bound and cleared.
+         */
+        bool begin(int width, int height, GLuint targetFramebuffer);
+
+        /**
+         * @brief Copies the layer into the target framebuffer and binds the target again.
+         */
+        void end();
+
+        /**
+         * @brief Marks the layer for a redraw on the next begin.
+         */
+        void invalidate();
+
+    private:
+        std::shared_ptr<Core::Logger> logger;
+        RenderStats &stats;
+        GLuint framebuffer;
+        GLuint texture;
+        /// @brief Framebuffer of the frame, restored after drawing the layer.
+        GLuint targetFramebuffer;
+        int width;
+        int height;
+        /// @brief Whether the texture holds the current layer contents.
+        bool isValid;
+
+        /**
+         * @brief Recreates the texture attachment for a new target size.
+         */
+        bool resize(int newWidth, int newHeight);
+    };
+}
@@ -0,0 +1,125 @@
+#include "glStreamBuffer.hpp"
+
+#include "../../core/logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace AntColony::Render::GLFW
+{
+    // Regions are rounded to this size so region starts keep any vertex stride alignment
+    constexpr const GLsizeiptr REGION_GRANULARITY = 256;
+    // Wait per glClientWaitSync call before logging a stall, in nanoseconds
+    constexpr const GLuint64 FENCE_TIMEOUT = 1000000000;
+
+    namespace
+    {
+        GLsizeiptr roundUp(GLsizeiptr value, GLsizeiptr alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    GLStreamBuffer::GLStreamBuffer(std::shared_ptr<Core::Logger> logger, RenderStats &stats, GLsizeiptr regionSize)
+        : logger(logger),
+          stats(stats),
+          buffer(0),
+          regionSize(roundUp(regionSize, REGION_GRANULARITY)),
+          region(0),
+          regionOffset(0),
+          fences{} {}
+
+    GLStreamBuffer::~GLStreamBuffer()
+    {
+        for (auto &fence : fences)
+        {
+            if (fence)
+                glDeleteSync(fence);
+        }
+        glDeleteBuffers(1, &buffer);
+    }
+
+    void GLStreamBuffer::init()
+    {
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, regionSize * FRAMES_IN_FLIGHT, nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void GLStreamBuffer::grow(GLsizeiptr minRegionSize)
+    {
+        regionSize = roundUp(std::max(regionSize * 2, minRegionSize), REGION_GRANULARITY);
+
+        // New storage is not read by any pending frame, the fences of the old one no longer matter
+        for (auto &fence : fences)
+        {
+            if (fence)
+                glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, regionSize * FRAMES_IN_FLIGHT, nullptr, GL_STREAM_DRAW);
+        regionOffset = 0;
+
+        logger->debug("Stream buffer regions grown to " + std::to_string(regionSize) + " bytes");
+    }
+
+    GLintptr GLStreamBuffer::write(const void *data, GLsizeiptr size, GLsizeiptr alignment)
+    {
+        auto offset = roundUp(regionOffset, alignment);
+        if (offset + size > regionSize)
+        {
+            grow(size);
+            offset = 0;
+        }
+
+        const auto bufferOffset = static_cast<GLintptr>(region) * regionSize + offset;
+
+        // The region is not read by the GPU any more, so the driver does not have to track it
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        auto *mapped = glMapBufferRange(GL_ARRAY_BUFFER, bufferOffset, size,
+                                        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (!mapped)
+        {
+            logger->error("Failed to map stream buffer");
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            return -1;
+        }
+
+        std::memcpy(mapped, data, size);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        stats.bufferUploads++;
+        stats.uploadedBytes += size;
+
+        regionOffset = offset + size;
+        return bufferOffset;
+    }
+
+    void GLStreamBuffer::endFrame()
+    {
+        if (fences[region])
+            glDeleteSync(fences[region]);
+        fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        region = (region + 1) % FRAMES_IN_FLIGHT;
+        regionOffset = 0;
+
+        auto &fence = fences[region];
+        if (!fence)
+            return;
+
+        // Normally signalled long ago, only blocks when the CPU runs FRAMES_IN_FLIGHT frames ahead
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT) == GL_TIMEOUT_EXPIRED)
+            logger->warning("Waiting for the GPU to release a stream buffer region");
+
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    GLuint GLStreamBuffer::getBuffer() const { return buffer; }
+}
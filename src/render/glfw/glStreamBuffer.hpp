@@ -0,0 +1,77 @@
+#pragma once
+#include "_fwd.hpp"
+#include "../../core/_fwd.hpp"
+
+#include "../renderStats.hpp"
+
+#include <array>
+#include <memory>
+#include "_gl.hpp"
+
+namespace AntColony::Render::GLFW
+{
+    /**
+     * @brief Ring of per-frame regions in one buffer for vertex data written every frame.
+     *
+     * Each frame writes into its own region without synchronisation. A fence is placed when the frame ends,
+     * and a region is only written again once the GPU has passed its fence, so the CPU prepares the next
+     * frames while the GPU still reads the previous ones.
+     */
+    class GLStreamBuffer
+    {
+    public:
+        /// @brief Frames the CPU may run ahead of the GPU.
+        static constexpr const int FRAMES_IN_FLIGHT = 3;
+
+        /**
+         * @brief Constructor with logger and the frame counters.
+         * @param logger Shared pointer to the logger instance.
+         * @param stats Counters of the current frame, owned by the render context.
+         * @param regionSize Initial bytes available to a frame, grown when a frame writes more.
+         */
+        GLStreamBuffer(std::shared_ptr<Core::Logger> logger, RenderStats &stats, GLsizeiptr regionSize);
+
+        /**
+         * @brief Destructor releases the buffer and pending fences, requires the GL context to still be current.
+         */
+        ~GLStreamBuffer();
+
+        /**
+         * @brief Allocates the buffer storage.
+         */
+        void init();
+
+        /**
+         * @brief Copies data into the region of the current frame.
+         * @param data Bytes to write.
+         * @param size Number of bytes.
+         * @param alignment Offset alignment, the vertex stride lets draws address the data by first vertex.
+         * @return Byte offset of the data in the buffer, or -1 on failure.
+         */
+        GLintptr write(const void *data, GLsizeiptr size, GLsizeiptr alignment);
+
+        /**
+         * @brief Fences the region of the finished frame and moves to the next one, waiting if the GPU still reads it.
+         */
+        void endFrame();
+
+        GLuint getBuffer() const;
+
+    private:
+        std::shared_ptr<Core::Logger> logger;
+        RenderStats &stats;
+        GLuint buffer;
+        GLsizeiptr regionSize;
+        /// @brief Region written by the current frame.
+        int region;
+        /// @brief Bytes used in the current region.
+        GLsizeiptr regionOffset;
+        /// @brief Fence per region, null when the region is free.
+        std::array<GLsync, FRAMES_IN_FLIGHT> fences;
+
+        /**
+         * @brief Reallocates the buffer with larger regions, orphaning the storage the GPU may still read.
+         */
+        void grow(GLsizeiptr minRegionSize);
+    };
+}
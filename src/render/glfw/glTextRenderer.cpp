@@ -1,9 +1,11 @@
-#include "text/_fonts.hpp"
+#include "../text/_fonts.hpp"
 #include "text/font.hpp"
+#include "../text/fontAtlas.hpp"
 
 #include "glShaders.hpp"
 #include "glTextRenderer.hpp"
 #include "glShaderProvider.hpp"
+#include "glStreamBuffer.hpp"
 
 #include "../../core/logger.hpp"
 #include "../../core/point.hpp"
@@ -23,35 +25,30 @@ namespace AntColony::Render::GLFW
     constexpr const auto RETURN_CHAR = 13;
     constexpr const auto SPACE_CHAR = 32;
 
-    constexpr const auto TAB_SIZE = 4.0f;
-    constexpr const auto MAX_ACII_CODE = 128;
-
-    // TEXTURE
-    constexpr const auto TEXTURE_SIZE = 512;
+    // Position and texture coordinates per glyph vertex
+    constexpr const GLsizeiptr TEXT_VERTEX_STRIDE = 4 * sizeof(float);
 
     bool GLTextRenderer::isSpecialChar(const char *c)
     {
         return *c == TAB_CHAR || *c == LINE_FEED_CHAR || *c == RETURN_CHAR || *c == SPACE_CHAR;
     }
 
-    GLTextRenderer::GLTextRenderer(std::shared_ptr<GLShaderProvider> shaderProvider, std::shared_ptr<AntColony::Core::Logger> logger)
-        : shaderProvider(shaderProvider), logger(logger), isInited(false) {}
+    GLTextRenderer::GLTextRenderer(std::shared_ptr<GLShaderProvider> shaderProvider, std::shared_ptr<AntColony::Core::Logger> logger, RenderStats &stats, std::shared_ptr<GLStreamBuffer> streamBuffer)
+        : shaderProvider(shaderProvider), logger(logger), stats(stats), streamBuffer(streamBuffer), textShaderProgram(0), textVAO(0), isInited(false) {}
 
     GLTextRenderer::~GLTextRenderer()
     {
         isInited = false;
 
-        // Clean up all font textures
-        for (auto &[size, font] : fontCache)
+        // Clean up font texture
+        if (font && font->tex_id != 0)
         {
-            if (font && font->tex_id != 0)
-            {
-                glDeleteTextures(1, &font->tex_id);
-                font->tex_id = 0;
-            }
+            glDeleteTextures(1, &font->tex_id);
+            font->tex_id = 0;
         }
-        fontCache.clear();
+        font.reset();
 
+        glDeleteVertexArrays(1, &textVAO);
         glDeleteProgram(textShaderProgram);
     }
 
@@ -64,6 +61,24 @@ namespace AntColony::Render::GLFW
             return;
         }
 
+        font = loadFont(MAIN_FONT_ATLAS, MAIN_FONT_ATLAS_LEN);
+        if (!font)
+        {
+            logger->error("Failed to load baked font atlas");
+            return;
+        }
+
+        // Attributes point at the start of the stream buffer, draws select their quads by first vertex
+        glGenVertexArrays(1, &textVAO);
+        glBindVertexArray(textVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, streamBuffer->getBuffer());
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, TEXT_VERTEX_STRIDE, reinterpret_cast<void *>(0));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, TEXT_VERTEX_STRIDE, reinterpret_cast<void *>(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
         isInited = true;
 
         // Log viewport
@@ -98,52 +113,50 @@ namespace AntColony::Render::GLFW
         // Using the smaller dimension to ensure text is proportional regardless of window aspect ratio
         float pixelFontSize = fontSize * (winWidth < winHeight ? winWidth : winHeight) * 0.5f;
 
-        // Get or load font for the requested size
-        auto it = fontCache.find(pixelFontSize);
-        if (it == fontCache.end())
-        {
-            auto font = loadFont(pixelFontSize);
-            if (!font)
-            {
-                logger->error("Failed to load font size: " + std::to_string(pixelFontSize));
-                return;
-            }
-            it = fontCache.emplace(pixelFontSize, font).first;
-            logger->debug("Loaded new font size: " + std::to_string(pixelFontSize));
-        }
+        // Distance field scales to any size, so only the ratio to the base size is needed
+        float sizeScale = pixelFontSize / font->size;
 
         float pixel_x = (position.x + 1.0f) * 0.5f * winWidth;
         float pixel_y = (1.0f - position.y) * 0.5f * winHeight;
 
-        drawTextCore(it->second, text.c_str(), pixel_x, pixel_y, color.r, color.g, color.b, static_cast<float>(winWidth), static_cast<float>(winHeight));
+        drawTextCore(font, text.c_str(), pixel_x, pixel_y, sizeScale, color.r, color.g, color.b, static_cast<float>(winWidth), static_cast<float>(winHeight));
     }
 
-    std::shared_ptr<Text::Font> GLTextRenderer::loadFont(float fontSize) const
+    std::shared_ptr<Text::Font> GLTextRenderer::loadFont(const unsigned char *atlasData, size_t atlasLength) const
     {
-        auto font = createFont(fontSize, MAX_ACII_CODE);
-
-        logger->debug("Initializing font for size: " + std::to_string(fontSize));
-        if (!tryInitializeFont(font, MAIN_FONT, fontSize))
+        Render::Text::FontAtlas atlas;
+        if (!Render::Text::FontAtlas::tryRead(atlasData, atlasLength, atlas))
         {
-            logger->error("Failed to initialize font: Invalid font data or file");
+            logger->error("Failed to initialize font: Invalid or outdated font atlas");
             return nullptr;
         }
+
+        const auto &header = atlas.header;
+        auto font = std::make_shared<Text::Font>();
+        font->size = header.size;
+        font->spacing = 0.0f;
+        font->sdf = header.sdf != 0;
+        font->scale = header.scale;
+        font->ascent = header.ascent;
+        font->descent = header.descent;
+        font->lineGap = header.lineGap;
+        font->lineHeight = header.lineHeight;
+        font->w = header.width;
+        font->h = header.height;
+        font->bitmap = atlas.bitmap;
+
         logger->debug("Font metrics: ascent=" + std::to_string(font->ascent) +
                       ", descent=" + std::to_string(font->descent) +
                       ", lineGap=" + std::to_string(font->lineGap) +
                       ", lineHeight=" + std::to_string(font->lineHeight));
 
-        if (!tryAllocateFontBitmap(font))
+        font->glyphCache.reserve(atlas.glyphs.size());
+        for (const auto &baked : atlas.glyphs)
         {
-            logger->error("Failed to allocate bitmap for font texture");
-            return nullptr;
+            font->glyphCache[baked.codepoint] = Text::GlyphInfo{
+                baked.advance, baked.lsb, baked.tex_x, baked.tex_y, baked.x0, baked.y0, baked.x1, baked.y1};
         }
 
-        int pos_x = 0, pos_y = 0, max_height = 0;
-
-        generateSpecialCharacterGlyphs(font, fontSize);
-        generateRegularCharacterGlyphs(font, pos_x, pos_y, max_height);
-
         if (!validateFontTexture(font))
         {
             return nullptr;
@@ -154,157 +167,10 @@ namespace AntColony::Render::GLFW
             return nullptr;
         }
 
-        logger->debug("Font loaded successfully with size: " + std::to_string(fontSize));
+        logger->debug("Font loaded successfully with size: " + std::to_string(font->size));
         return font;
     }
 
-    std::shared_ptr<Text::Font> GLTextRenderer::createFont(float fontSize, int numberOfGlyphs)
-    {
-        auto font = std::make_shared<Text::Font>();
-        font->size = fontSize;
-        font->spacing = 0.0f;
-        font->sdf = false;
-        font->glyphCache.reserve(numberOfGlyphs);
-
-        return font;
-    }
-
-    bool GLTextRenderer::tryInitializeFont(std::shared_ptr<Text::Font> font, const unsigned char *fontData, float fontSize)
-    {
-        if (!stbtt_InitFont(&font->font, fontData, 0))
-        {
-            return false;
-        }
-
-        font->scale = stbtt_ScaleForPixelHeight(&font->font, fontSize);
-        stbtt_GetFontVMetrics(&font->font, &font->ascent, &font->descent, &font->lineGap);
-        font->lineHeight = (font->ascent - font->descent + font->lineGap) * font->scale;
-        return true;
-    }
-
-    bool GLTextRenderer::tryAllocateFontBitmap(std::shared_ptr<Text::Font> font)
-    {
-        font->w = TEXTURE_SIZE;
-        font->h = TEXTURE_SIZE;
-        font->bitmap = new unsigned char[font->w * font->h]();
-        if (!font->bitmap)
-        {
-            return false;
-        }
-        return true;
-    }
-
-    void GLTextRenderer::generateSpecialCharacterGlyphs(std::shared_ptr<Text::Font> font, float fontSize) const
-    {
-        for (int c : {SPACE_CHAR, TAB_CHAR, LINE_FEED_CHAR, RETURN_CHAR})
-        {
-            Text::GlyphInfo info{};
-            stbtt_GetCodepointHMetrics(&font->font, c, &info.advance, &info.lsb);
-            stbtt_GetCodepointBitmapBox(&font->font, c, font->scale, font->scale, &info.x0, &info.y0, &info.x1, &info.y1);
-            info.tex_x = 0;
-            info.tex_y = 0;
-            info.x0 = 0;
-            info.y0 = 0;
-            info.x1 = 0;
-            info.y1 = 0;
-
-            if (c == SPACE_CHAR)
-            {
-                if (info.advance <= 0)
-                {
-                    logger->warning("Invalid advance for space, using default: " + std::to_string(info.advance));
-                    info.advance = static_cast<int>(fontSize / 4.0f);
-                }
-            }
-            else if (c == TAB_CHAR)
-            {
-                info.advance = font->glyphCache[SPACE_CHAR].advance * TAB_SIZE;
-            }
-            else
-            {
-                info.advance = 0;
-            }
-
-            font->glyphCache[c] = info;
-            std::string charName;
-            switch (c)
-            {
-            case SPACE_CHAR:
-                charName = " ";
-                break;
-            case TAB_CHAR:
-                charName = "\\t";
-                break;
-            case LINE_FEED_CHAR:
-                charName = "\\n";
-                break;
-            case RETURN_CHAR:
-                charName = "\\r";
-                break;
-            }
-            logger->debug("Special char '" + charName + "' advance=" + std::to_string(info.advance));
-        }
-    }
-
-    void GLTextRenderer::generateRegularCharacterGlyphs(std::shared_ptr<Text::Font> font, int &pos_x, int &pos_y, int &max_height) const
-    {
-        for (auto c = SPACE_CHAR + 1; c < MAX_ACII_CODE; c++)
-        {
-            Text::GlyphInfo info{};
-            stbtt_GetCodepointHMetrics(&font->font, c, &info.advance, &info.lsb);
-            stbtt_GetCodepointBitmapBox(&font->font, c, font->scale, font->scale, &info.x0, &info.y0, &info.x1, &info.y1);
-            int w = info.x1 - info.x0, h = info.y1 - info.y0;
-
-            if (info.advance <= 0)
-            {
-                logger->warning("Invalid advance for char '" + std::string(1, static_cast<char>(c)) +
-                                "', using default: " + std::to_string(info.advance));
-                info.advance = static_cast<int>(font->size / 2.0f);
-            }
-            if (w <= 0 || h <= 0)
-            {
-                logger->warning("Invalid glyph dimensions for char '" + std::string(1, static_cast<char>(c)) +
-                                "', using default size");
-                w = static_cast<int>(font->size / 2.0f);
-                h = static_cast<int>(font->size);
-                info.x1 = info.x0 + w;
-                info.y1 = info.y0 + h;
-            }
-            if (pos_x + w > font->w)
-            {
-                pos_x = 0;
-                pos_y += max_height + 1;
-                max_height = 0;
-            }
-            auto *glyph_bitmap = stbtt_GetCodepointBitmap(&font->font, font->scale, font->scale, c, &w, &h, 0, 0);
-            if (!glyph_bitmap)
-            {
-                logger->error("Failed to generate glyph bitmap for character: " + std::to_string(c));
-                continue;
-            }
-
-            copyGlyphToBitmap(font, glyph_bitmap, pos_x, pos_y, w, h);
-            stbtt_FreeBitmap(glyph_bitmap, nullptr);
-
-            info.tex_x = pos_x;
-            info.tex_y = pos_y;
-            font->glyphCache[c] = info;
-            pos_x += w + 1;
-            max_height = std::max(max_height, h);
-        }
-    }
-
-    void GLTextRenderer::copyGlyphToBitmap(std::shared_ptr<Text::Font> font, const unsigned char *glyph_bitmap, int pos_x, int pos_y, int w, int h)
-    {
-        for (int j = 0; j < h; j++)
-        {
-            for (int i = 0; i < w; i++)
-            {
-                font->bitmap[(pos_y + j) * font->w + pos_x + i] = glyph_bitmap[j * w + i];
-            }
-        }
-    }
-
     bool GLTextRenderer::validateFontTexture(std::shared_ptr<Text::Font> font) const
     {
         int nonZeroPixels = 0;
@@ -317,7 +183,6 @@ namespace AntColony::Render::GLFW
         if (nonZeroPixels == 0)
         {
             logger->error("Font texture is empty");
-            delete[] font->bitmap;
             return false;
         }
         return true;
@@ -330,7 +195,6 @@ namespace AntColony::Render::GLFW
         if (font->tex_id == 0)
         {
             logger->error("Failed to generate texture ID for font");
-            delete[] font->bitmap;
             return false;
         }
         glBindTexture(GL_TEXTURE_2D, font->tex_id);
@@ -338,20 +202,22 @@ namespace AntColony::Render::GLFW
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // Baked atlas rows are tightly packed and not necessarily 4-byte aligned
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, font->w, font->h, 0, GL_RED, GL_UNSIGNED_BYTE, font->bitmap);
         GLenum err = glGetError();
         if (err != GL_NO_ERROR)
         {
             logger->error("OpenGL error during texture upload: " + std::to_string(err));
             glDeleteTextures(1, &font->tex_id);
-            delete[] font->bitmap;
+            font->tex_id = 0;
             return false;
         }
         glBindTexture(GL_TEXTURE_2D, 0);
         return true;
     }
 
-    void GLTextRenderer::drawTextCore(const std::shared_ptr<Text::Font> font, const char *text, float x, float y, float r, float g, float b, float winWidth, float winHeight) const
+    void GLTextRenderer::drawTextCore(const std::shared_ptr<Text::Font> font, const char *text, float x, float y, float sizeScale, float r, float g, float b, float winWidth, float winHeight) const
     {
         if (!font || font->tex_id == 0)
         {
@@ -359,8 +225,7 @@ namespace AntColony::Render::GLFW
             return;
         }
 
-        const auto boundTex = setupTexture(font->tex_id);
-        logger->debug("Bound texture ID: " + std::to_string(boundTex));
+        setupTexture(font->tex_id);
 
         std::vector<float> vertices;
         float cursor_x = x;
@@ -378,19 +243,19 @@ namespace AntColony::Render::GLFW
 
             if (isSpecialChar(c))
             {
-                handleSpecialCharacter(font, *c, cursor_x, cursor_y, x, font->scale, font->lineHeight);
+                handleSpecialCharacter(font, *c, cursor_x, cursor_y, x, font->scale * sizeScale, font->lineHeight * sizeScale);
                 renderedGlyphs++;
                 continue;
             }
 
             const auto &glyph = it->second;
 
-            if (tryAddGlyphVertices(font, glyph, cursor_x, cursor_y, winHeight, vertices))
+            if (tryAddGlyphVertices(font, glyph, cursor_x, cursor_y, sizeScale, winHeight, vertices))
             {
                 renderedGlyphs++;
             }
 
-            cursor_x += static_cast<float>(glyph.advance) * font->scale;
+            cursor_x += static_cast<float>(glyph.advance) * font->scale * sizeScale;
         }
 
         logger->debug("Prepared " + std::to_string(renderedGlyphs) + " glyphs for rendering");
@@ -407,47 +272,39 @@ namespace AntColony::Render::GLFW
         logger->debug("Text rendered: " + std::string(text));
     }
 
-    GLint GLTextRenderer::setupTexture(const unsigned int &textId)
+    void GLTextRenderer::setupTexture(const unsigned int &textId) const
     {
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, textId);
-        GLint boundTex;
-        glGetIntegerv(GL_TEXTURE_BINDING_2D, &boundTex);
+        stats.textureBinds++;
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        return boundTex;
     }
 
     void GLTextRenderer::renderVertices(const std::vector<float> &vertices, float r, float g, float b, float winWidth, float winHeight) const
     {
-        GLuint vao, vbo;
-        glGenVertexArrays(1, &vao);
-        glGenBuffers(1, &vbo);
-        glBindVertexArray(vao);
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), reinterpret_cast<void *>(0));
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), reinterpret_cast<void *>(2 * sizeof(float)));
-        glEnableVertexAttribArray(1);
+        const auto offset = streamBuffer->write(vertices.data(), vertices.size() * sizeof(float), TEXT_VERTEX_STRIDE);
+        if (offset < 0)
+        {
+            glDisable(GL_BLEND);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            return;
+        }
+
+        glBindVertexArray(textVAO);
+        stats.vertexArrayBinds++;
         glUseProgram(textShaderProgram);
         glUniform1i(glGetUniformLocation(textShaderProgram, "uFontTex"), 0);
         glUniform3f(glGetUniformLocation(textShaderProgram, "uColor"), r, g, b);
         auto ortho = glm::ortho(0.0f, winWidth, 0.0f, winHeight);
         glUniformMatrix4fv(glGetUniformLocation(textShaderProgram, "uOrtho"), 1, GL_FALSE, &ortho[0][0]);
-        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size() / 4));
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        stats.programBinds++;
+        stats.uniformUploads += 3;
+        glDrawArrays(GL_TRIANGLES, static_cast<GLint>(offset / TEXT_VERTEX_STRIDE), static_cast<GLsizei>(vertices.size() / 4));
+        stats.drawCalls++;
         glBindVertexArray(0);
-        glDeleteBuffers(1, &vbo);
-        glDeleteVertexArrays(1, &vao);
         glDisable(GL_BLEND);
         glBindTexture(GL_TEXTURE_2D, 0);
-
-        GLenum err;
-        while ((err = glGetError()) != GL_NO_ERROR)
-        {
-            logger->error("OpenGL error during text rendering: " + std::to_string(err));
-        }
     }
 
     void GLTextRenderer::handleSpecialCharacter(const std::shared_ptr<Text::Font> font, char c, float &cursor_x, float &cursor_y, float x, float fontScale, float lineHeight) const
@@ -483,6 +340,7 @@ namespace AntColony::Render::GLFW
         const Text::GlyphInfo &glyph,
         const float cursor_x,
         const float cursor_y,
+        const float sizeScale,
         float winHeight,
         std::vector<float> &vertices) const
     {
@@ -493,15 +351,15 @@ namespace AntColony::Render::GLFW
         if (w <= 0 || h <= 0)
             return false;
 
-        float posX = cursor_x;
-        float posY = cursor_y - font->ascent * font->scale + static_cast<float>(glyph.y0);
+        float posX = cursor_x + static_cast<float>(glyph.x0) * sizeScale;
+        float posY = cursor_y + (static_cast<float>(glyph.y0) - font->ascent * font->scale) * sizeScale;
 
         float u0 = static_cast<float>(glyph.tex_x) / font->w;
         float v0 = static_cast<float>(glyph.tex_y + h) / font->h;
         float u1 = static_cast<float>(glyph.tex_x + w) / font->w;
         float v1 = static_cast<float>(glyph.tex_y) / font->h;
-        float posX2 = posX + static_cast<float>(w);
-        float posY2 = posY + static_cast<float>(h);
+        float posX2 = posX + static_cast<float>(w) * sizeScale;
+        float posY2 = posY + static_cast<float>(h) * sizeScale;
         float flippedPosY = winHeight - posY;
         float flippedPosY2 = winHeight - posY2;
 
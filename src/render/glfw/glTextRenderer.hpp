@@ -2,11 +2,11 @@
 #include "_fwd.hpp"
 #include "text/_fwd.hpp"
 #include "../../core/_fwd.hpp"
+#include "../renderStats.hpp"
 
 #include <memory>
 #include <string>
 #include "_gl.hpp"
-#include <unordered_map>
 #include <vector>
 
 namespace AntColony::Render::GLFW
@@ -21,8 +21,10 @@ namespace AntColony::Render::GLFW
          * @brief Constructor initializes renderer with a shader provider and logger.
          * @param shaderProvider Shared pointer to the shader provider instance.
          * @param logger Shared pointer to the logger instance.
+         * @param stats Counters of the current frame, owned by the render context.
+         * @param streamBuffer Ring the glyph quads are written to every frame.
          */
-        explicit GLTextRenderer(std::shared_ptr<GLShaderProvider> shaderProvider, std::shared_ptr<AntColony::Core::Logger> logger);
+        GLTextRenderer(std::shared_ptr<GLShaderProvider> shaderProvider, std::shared_ptr<AntColony::Core::Logger> logger, RenderStats &stats, std::shared_ptr<GLStreamBuffer> streamBuffer);
 
         /**
          * @brief Destructor cleans up OpenGL resources.
@@ -30,7 +32,7 @@ namespace AntColony::Render::GLFW
         ~GLTextRenderer();
 
         /**
-         * @brief Initializes shaders for rendering.
+         * @brief Initializes shaders for rendering, the stream buffer must be initialized first.
          */
         void init();
 
@@ -48,70 +50,26 @@ namespace AntColony::Render::GLFW
         std::shared_ptr<GLShaderProvider> shaderProvider;
         /// @brief Shared pointer to the logger for error reporting.
         std::shared_ptr<AntColony::Core::Logger> logger;
+        /// @brief Counters of the current frame.
+        RenderStats &stats;
+        /// @brief Ring holding the glyph quads of the frames in flight.
+        std::shared_ptr<GLStreamBuffer> streamBuffer;
         /// @brief Shader program for rendering shapes (circles, frames).
         GLuint textShaderProgram;
-        /// @brief Shader program for rendering shapes (circles, frames).
-        std::unordered_map<float, std::shared_ptr<Text::Font>> fontCache;
+        /// @brief Vertex Array Object reading glyph quads from the stream buffer.
+        GLuint textVAO;
+        /// @brief Single signed distance field font, scaled to any requested size.
+        std::shared_ptr<Text::Font> font;
         /// @brief Tracks initialization state.
         bool isInited;
 
         /**
-         * @brief Loads a font with the specified size.
-         * @param fontSize Size of the font in pixels.
+         * @brief Loads the font atlas baked at build time.
+         * @param atlasData Binary blob produced by the font baker.
+         * @param atlasLength Length of the blob in bytes.
          * @return Unique pointer to the loaded font structure, or nullptr on failure.
          */
-        std::shared_ptr<Text::Font> loadFont(float fontSize) const;
-
-        /**
-         * @brief Factory method that initializes font structure with basic parameters.
-         * @param fontSize Size of the font in pixels.
-         * @param numberOfGlyphs Hint of how many glyphs will be stored in the font.
-         * @return Pointer to the loaded font structure.
-         */
-        static std::shared_ptr<Text::Font> createFont(float fontSize, int numberOfGlyphs);
-
-        /**
-         * @brief Initializes font metrics.
-         * @param font Font to initialize.
-         * @param fontData Binary data of the font.
-         * @param fontSize Size of the font in pixels.
-         * @return True if successful, false otherwise.
-         */
-        static bool tryInitializeFont(std::shared_ptr<Text::Font> font, const unsigned char *fontData, float fontSize);
-
-        /**
-         * @brief Allocates memory for the font bitmap.
-         * @param font Font to allocate bitmap for.
-         * @return True if successful, false otherwise.
-         */
-        static bool tryAllocateFontBitmap(std::shared_ptr<Text::Font> font);
-
-        /**
-         * @brief Generates glyphs for special characters (space, tab, newline, etc.).
-         * @param font Font to generate glyphs for.
-         * @param fontSize Size of the font in pixels.
-         */
-        void generateSpecialCharacterGlyphs(std::shared_ptr<Text::Font> font, float fontSize) const;
-
-        /**
-         * @brief Generates glyphs for regular characters.
-         * @param font Font to generate glyphs for.
-         * @param pos_x X position in the bitmap, updated as glyphs are added.
-         * @param pos_y Y position in the bitmap, updated as glyphs are added.
-         * @param max_height Maximum height of glyphs in the current row, updated as glyphs are added.
-         */
-        void generateRegularCharacterGlyphs(std::shared_ptr<Text::Font> font, int &pos_x, int &pos_y, int &max_height) const;
-
-        /**
-         * @brief Copies a glyph bitmap to the font bitmap.
-         * @param font Font to copy to.
-         * @param glyph_bitmap Source bitmap to copy from.
-         * @param pos_x X position in the destination bitmap.
-         * @param pos_y Y position in the destination bitmap.
-         * @param w Width of the glyph.
-         * @param h Height of the glyph.
-         */
-        static void copyGlyphToBitmap(std::shared_ptr<Text::Font> font, const unsigned char *glyph_bitmap, int pos_x, int pos_y, int w, int h);
+        std::shared_ptr<Text::Font> loadFont(const unsigned char *atlasData, size_t atlasLength) const;
 
         /**
          * @brief Validates that the font texture contains actual data.
@@ -133,13 +91,14 @@ namespace AntColony::Render::GLFW
          * @param text Text to render.
          * @param x X-coordinate for text position.
          * @param y Y-coordinate for text position.
+         * @param sizeScale Ratio of the requested pixel size to the font base size.
          * @param r Red component of text color.
          * @param g Green component of text color.
          * @param b Blue component of text color.
          * @param winWidth Window width for orthographic projection.
          * @param winHeight Window height for orthographic projection.
          */
-        void drawTextCore(const std::shared_ptr<Text::Font> font, const char *text, float x, float y, float r, float g, float b, float winWidth, float winHeight) const;
+        void drawTextCore(const std::shared_ptr<Text::Font> font, const char *text, float x, float y, float sizeScale, float r, float g, float b, float winWidth, float winHeight) const;
 
         /**
          * @brief Handles cursor positioning for special characters.
@@ -166,6 +125,7 @@ namespace AntColony::Render::GLFW
          * @param glyph Glyph information.
          * @param cursor_x Current X cursor position.
          * @param cursor_y Current Y cursor position.
+         * @param sizeScale Ratio of the requested pixel size to the font base size.
          * @param winHeight Window height for coordinate flipping.
          * @param vertices Vector to add vertices to.
          * @return True if successful, false otherwise.
@@ -175,17 +135,18 @@ namespace AntColony::Render::GLFW
             const Text::GlyphInfo &glyph,
             const float cursor_x,
             const float cursor_y,
+            const float sizeScale,
             float winHeight,
             std::vector<float> &vertices) const;
 
         /**
          * @brief Sets up OpenGL state for text rendering.
-         * @param boundTex Font texture id to bind.
+         * @param textId Font texture id to bind.
          */
-        static GLint setupTexture(const unsigned int &textId);
+        void setupTexture(const unsigned int &textId) const;
 
         /**
-         * @brief Renders vertices using OpenGL.
+         * @brief Writes vertices to the stream buffer and draws them, without querying GL state.
          * @param vertices Vertex data to render.
          * @param r Red component of text color.
          * @param g Green component of text color.
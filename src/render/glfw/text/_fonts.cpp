@@ -1,2 +0,0 @@
-#define STB_TRUETYPE_IMPLEMENTATION
-#include "_fonts.hpp"
\ No newline at end of file
@@ -1,7 +0,0 @@
-#pragma once
-
-#include <dejavu_fonts.hpp>
-#include <stb_truetype.h>
-
-constexpr const auto MAIN_FONT      = DEJAVU_SANS_MONO_TTF;
-constexpr const auto MAIN_FONT_LEN  = DEJAVU_SANS_MONO_TTF_LEN;
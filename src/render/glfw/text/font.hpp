@@ -1,7 +1,5 @@
 #pragma once
 
-#include "_fonts.hpp"
-
 #include "glyphInfo.hpp"
 #include <unordered_map>
 
@@ -34,10 +32,8 @@ namespace AntColony::Render::GLFW::Text
         int w;
         /// @brief Height of the font atlas texture.
         int h;
-        /// @brief Bitmap data for the font atlas.
-        unsigned char *bitmap;
-        /// @brief STB TrueType font info.
-        stbtt_fontinfo font;
+        /// @brief Bitmap data for the font atlas, points into the baked blob.
+        const unsigned char *bitmap;
         /// @brief Cache of glyph information, indexed by character code.
         std::unordered_map<int, GlyphInfo> glyphCache;
 
@@ -47,19 +43,7 @@ namespace AntColony::Render::GLFW::Text
         Font() : size(0.0f), spacing(0.0f), sdf(false), scale(0.0f), lineHeight(0.0f),
                  ascent(0), descent(0), lineGap(0), tex_id(0), w(0), h(0), bitmap(nullptr) {}
 
-        /**
-         * @brief Destructor frees bitmap if allocated.
-         */
-        ~Font()
-        {
-            if (bitmap)
-            {
-                delete[] bitmap;
-                bitmap = nullptr;
-            }
-        }
-
-        // Disable copy to prevent double-free of bitmap
+        // Disable copy, fonts own a GPU texture
         Font(const Font &) = delete;
         Font &operator=(const Font &) = delete;
 
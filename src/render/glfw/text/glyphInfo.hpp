@@ -1,8 +1,5 @@
 #pragma once
 
-#include "_fonts.hpp"
-#include <unordered_map>
-
 namespace AntColony::Render::GLFW::Text
 {
     /**
@@ -1,14 +1,17 @@
 #include "render.hpp"
 
 #include "glfw/glRenderContext.hpp"
+#include "software/swRenderContext.hpp"
 
 #include <memory>
 
 namespace AntColony::Render
 {
-    std::unique_ptr<RenderContext> initRenderContext(RENDER_ENGINE engine, std::shared_ptr<Core::Logger> logger)
+    std::unique_ptr<RenderContext> initRenderContext(RENDER_ENGINE engine, std::shared_ptr<Core::Logger> logger, const RenderSettings &settings)
     {
-        auto ctx = GLFW::GLRenderContext::getInstance(logger);
+        auto ctx = engine == SOFTWARE
+                       ? Software::SWRenderContext::getInstance(logger, settings)
+                       : GLFW::GLRenderContext::getInstance(logger, settings);
         ctx->init();
         return ctx;
     }
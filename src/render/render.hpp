@@ -3,10 +3,11 @@
 #include "../core/logger.hpp"
 #include "renderEngines.hpp"
 #include "renderContext.hpp"
+#include "renderSettings.hpp"
 
 #include <memory>
 
 namespace AntColony::Render
 {
-    extern std::unique_ptr<RenderContext> initRenderContext(RENDER_ENGINE engine, std::shared_ptr<Core::Logger> logger);
+    extern std::unique_ptr<RenderContext> initRenderContext(RENDER_ENGINE engine, std::shared_ptr<Core::Logger> logger, const RenderSettings &settings);
 }
\ No newline at end of file
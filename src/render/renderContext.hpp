@@ -1,7 +1,6 @@
 #pragma once
 
 #include "_fwd.hpp"
-#include <memory>
 
 namespace AntColony::Render
 {
@@ -12,6 +11,15 @@ namespace AntColony::Render
         virtual void init() = 0;
         virtual bool getInited() const = 0;
         virtual bool shouldClose() const = 0;
-        virtual std::unique_ptr<FrameContext> getFrameContext() const = 0;
+
+        /**
+         * @brief Prepares the target for drawing and returns the context's frame view.
+         */
+        virtual FrameContext &beginFrame() = 0;
+
+        /**
+         * @brief Presents the frame, processes window events and waits for the next frame slot.
+         */
+        virtual void endFrame() = 0;
     };
 }
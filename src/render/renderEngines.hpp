@@ -5,5 +5,7 @@ namespace AntColony::Render
     enum RENDER_ENGINE
     {
         OPENGL,
+        /// @brief CPU rasteriser into an in-memory framebuffer, needs no GPU or display.
+        SOFTWARE,
     };
-}
\ No newline at end of file
+}
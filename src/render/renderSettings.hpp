@@ -0,0 +1,48 @@
+#pragma once
+
+#include "circleRenderMode.hpp"
+#include "framePacing.hpp"
+#include "capture/captureFormat.hpp"
+
+#include <string>
+
+namespace AntColony::Render
+{
+    /// @brief Default frame time in milliseconds (30 FPS).
+    constexpr auto DEFAULT_FRAME_TIME = 1000.0f / 30.0f;
+    /// @brief Default width and height of the render target in pixels.
+    constexpr auto DEFAULT_FRAME_SIZE = 720;
+
+    /**
+     * @brief Options for creating a render context.
+     */
+    struct RenderSettings
+    {
+        /// @brief Frame pacing strategy.
+        FRAME_PACING pacing = FIXED_RATE;
+        /// @brief Target frame time in milliseconds for FIXED_RATE pacing.
+        float frameTime = DEFAULT_FRAME_TIME;
+        /// @brief Log achieved FPS and frame-time percentiles periodically, always on when UNCAPPED.
+        bool reportFrameStats = false;
+        /// @brief Width of the window or framebuffer in pixels.
+        int width = DEFAULT_FRAME_SIZE;
+        /// @brief Height of the window or framebuffer in pixels.
+        int height = DEFAULT_FRAME_SIZE;
+        /// @brief Number of frames after which the context asks to close, 0 runs until the window is closed.
+        int frameLimit = 0;
+        /// @brief Threads used by the software rasteriser, 0 selects the hardware concurrency.
+        unsigned int renderThreads = 0;
+        /// @brief Render GL into a framebuffer object through a headless EGL or OSMesa context instead of a window.
+        bool offscreen = false;
+        /// @brief Circle rasterisation of the OpenGL engine.
+        CIRCLE_RENDER_MODE circleMode = SDF_QUAD;
+        /// @brief Reports GL errors through a KHR_debug callback, only available in builds without NDEBUG.
+        bool debugOutput = false;
+        /// @brief Encoding of captured frames, NO_CAPTURE disables the capture stage.
+        Capture::CAPTURE_FORMAT captureFormat = Capture::NO_CAPTURE;
+        /// @brief Y4M file or PPM directory to write captured frames to, "-" writes to stdout.
+        std::string capturePath = "-";
+        /// @brief Frames buffered between the render loop and the writer thread before frames are dropped.
+        unsigned int captureQueueSize = 8;
+    };
+}
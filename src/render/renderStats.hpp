@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+namespace AntColony::Render
+{
+    /**
+     * @brief Cost counters of a single frame.
+     *
+     * Binds only count binding an object, not resetting the binding to 0.
+     */
+    struct RenderStats
+    {
+        /// @brief Draw calls submitted.
+        std::uint32_t drawCalls = 0;
+        /// @brief Shader program binds.
+        std::uint32_t programBinds = 0;
+        /// @brief Vertex array object binds.
+        std::uint32_t vertexArrayBinds = 0;
+        /// @brief Texture binds.
+        std::uint32_t textureBinds = 0;
+        /// @brief Individual uniform values set.
+        std::uint32_t uniformUploads = 0;
+        /// @brief Buffer and texture data uploads.
+        std::uint32_t bufferUploads = 0;
+        /// @brief Bytes uploaded to buffers and textures.
+        std::uint64_t uploadedBytes = 0;
+        /// @brief Milliseconds of CPU time spent issuing the frame, from beginFrame until endFrame.
+        float submitTime = 0.0f;
+        /// @brief Milliseconds from beginFrame until the frame was submitted, excluding pacing.
+        float frameTime = 0.0f;
+    };
+}
@@ -20,5 +20,33 @@ namespace AntColony::Render
          * @brief Draws a given text at the position with a given color
          */
         virtual void drawText(const Core::Point &position, const std::string &text, const Core::Color &color, const float fontSize) = 0;
+
+        /**
+         * @brief Draws a density grid over its area, mapping density to a colour ramp towards a given color
+         */
+        virtual void drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color) = 0;
+
+        /**
+         * @brief Draws a coverage grid over its area in a flat color, a cell's value over grid.maxValue is its opacity.
+         *        Used to splat entities too small to be drawn individually.
+         */
+        virtual void drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color) = 0;
+
+        /**
+         * @brief Starts the retained static layer, must come before any other draw of the frame.
+         * @return True if the layer has to be redrawn, draws until endStaticLayer then go into it;
+         *         false if the cached layer is still valid and its draws can be skipped.
+         */
+        virtual bool beginStaticLayer() = 0;
+
+        /**
+         * @brief Finishes the static layer and composites it as the background of the frame.
+         */
+        virtual void endStaticLayer() = 0;
+
+        /**
+         * @brief Forces the static layer to be redrawn, e.g. when its contents change. Resizes invalidate it implicitly.
+         */
+        virtual void invalidateStaticLayer() = 0;
     };
 }
\ No newline at end of file
@@ -0,0 +1,7 @@
+namespace AntColony::Render::Software
+{
+    class SWRenderContext;
+    class SWFrameContext;
+    class SWRenderer;
+    class Framebuffer;
+}
@@ -0,0 +1,14 @@
+#include "swRenderer.hpp"
+#include "swFrameContext.hpp"
+
+namespace AntColony::Render::Software
+{
+    SWFrameContext::SWFrameContext(SWRenderer &renderer, const RenderStats &stats, const Camera &camera)
+        : renderer(renderer), stats(stats), camera(camera)
+    {
+    }
+
+    Renderer &SWFrameContext::getRenderer() const { return renderer; }
+    const RenderStats &SWFrameContext::getStats() const { return stats; }
+    const Camera &SWFrameContext::getCamera() const { return camera; }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "_fwd.hpp"
+
+#include "../frameContext.hpp"
+
+namespace AntColony::Render::Software
+{
+    class SWFrameContext : public FrameContext
+    {
+    public:
+        SWFrameContext(SWRenderer &renderer, const RenderStats &stats, const Camera &camera);
+        ~SWFrameContext() override = default;
+
+        // FrameContext
+        Renderer &getRenderer() const override;
+        const RenderStats &getStats() const override;
+        const Camera &getCamera() const override;
+
+    private:
+        SWRenderer &renderer;
+        const RenderStats &stats;
+        const Camera &camera;
+    };
+}
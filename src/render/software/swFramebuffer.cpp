@@ -0,0 +1,19 @@
+#include "swFramebuffer.hpp"
+
+#include <cstddef>
+
+namespace AntColony::Render::Software
+{
+    Framebuffer::Framebuffer(int width, int height)
+        : width(width),
+          height(height),
+          pixels(static_cast<std::size_t>(width) * height, 0) {}
+
+    int Framebuffer::getWidth() const { return width; }
+    int Framebuffer::getHeight() const { return height; }
+
+    Pixel *Framebuffer::getRow(int y) { return pixels.data() + static_cast<std::size_t>(y) * width; }
+    const Pixel *Framebuffer::getRow(int y) const { return pixels.data() + static_cast<std::size_t>(y) * width; }
+
+    const Pixel *Framebuffer::getPixels() const { return pixels.data(); }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "_fwd.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace AntColony::Render::Software
+{
+    /// @brief RGBA8 pixel, red in the lowest byte.
+    using Pixel = std::uint32_t;
+
+    /**
+     * @brief In-memory RGBA8 render target, row 0 is the top of the image.
+     */
+    class Framebuffer
+    {
+    public:
+        Framebuffer(int width, int height);
+
+        int getWidth() const;
+        int getHeight() const;
+
+        Pixel *getRow(int y);
+        const Pixel *getRow(int y) const;
+
+        /**
+         * @brief Tightly packed pixel rows, width * height pixels.
+         */
+        const Pixel *getPixels() const;
+
+    private:
+        int width;
+        int height;
+        std::vector<Pixel> pixels;
+    };
+}
@@ -0,0 +1,97 @@
+#include "swRenderContext.hpp"
+
+#include "../capture/frameWriter.hpp"
+#include "../../core/logger.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace AntColony::Render::Software
+{
+    std::unique_ptr<RenderContext> SWRenderContext::getInstance(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings)
+    {
+        return std::unique_ptr<RenderContext>(new SWRenderContext(logger, settings));
+    }
+
+    SWRenderContext::SWRenderContext(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings)
+        : logger(logger),
+          settings(settings),
+          isInited(false),
+          frameCount(0),
+          framebuffer(settings.width, settings.height),
+          camera(),
+          renderer(std::make_unique<SWRenderer>(logger, settings.renderThreads, frameStats, camera)),
+          pacer(std::make_unique<FramePacer>(settings, logger)),
+          frameContext(*renderer, lastFrameStats, camera) {}
+
+    SWRenderContext::~SWRenderContext() = default;
+
+    void SWRenderContext::init()
+    {
+        if (settings.width <= 0 || settings.height <= 0)
+        {
+            logger->error("Invalid framebuffer size: " + std::to_string(settings.width) + "x" + std::to_string(settings.height));
+            return;
+        }
+
+        if (settings.pacing == VSYNC)
+            logger->warning("VSYNC pacing has no display to wait for, frames are not paced");
+
+        if (!renderer->init())
+            return;
+
+        logger->debug("Software framebuffer (" +
+                      std::to_string(settings.width) + "x" +
+                      std::to_string(settings.height) +
+                      ") initialized");
+
+        frameWriter = Capture::FrameWriter::create(settings, logger);
+
+        pacer->reset();
+        isInited = true;
+    }
+
+    bool SWRenderContext::getInited() const { return isInited; }
+    bool SWRenderContext::shouldClose() const { return settings.frameLimit > 0 && frameCount >= settings.frameLimit; }
+
+    FrameContext &SWRenderContext::beginFrame()
+    {
+        frameStart = std::chrono::steady_clock::now();
+        frameStats = RenderStats{};
+
+        camera.setViewportSize(framebuffer.getWidth(), framebuffer.getHeight());
+        renderer->beginFrame(framebuffer.getWidth(), framebuffer.getHeight());
+        return frameContext;
+    }
+
+    void SWRenderContext::endFrame()
+    {
+        frameStats.submitTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+        renderer->rasterise(framebuffer);
+
+        frameStats.frameTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        lastFrameStats = frameStats;
+
+        if (frameWriter)
+            captureFrame();
+
+        frameCount++;
+        pacer->waitForNextFrame();
+    }
+
+    void SWRenderContext::captureFrame()
+    {
+        // Pixels already are top-down RGBA8 bytes, the writer takes them as they are
+        auto *frame = frameWriter->acquireFrame();
+        if (!frame)
+            return;
+
+        std::memcpy(frame->pixels.data(), framebuffer.getPixels(), frame->pixels.size());
+        frame->bottomUp = false;
+        frame->frameIndex = static_cast<std::uint64_t>(frameCount);
+        frameWriter->submitFrame(frame);
+    }
+
+    const Framebuffer &SWRenderContext::getFramebuffer() const { return framebuffer; }
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "_fwd.hpp"
+#include "../capture/_fwd.hpp"
+#include "../../core/_fwd.hpp"
+
+#include "../renderContext.hpp"
+#include "../renderSettings.hpp"
+#include "../framePacer.hpp"
+#include "../renderStats.hpp"
+#include "../camera.hpp"
+#include "swFramebuffer.hpp"
+#include "swRenderer.hpp"
+#include "swFrameContext.hpp"
+
+#include <chrono>
+#include <memory>
+
+namespace AntColony::Render::Software
+{
+    /**
+     * @brief Headless render context rasterising into an in-memory framebuffer.
+     *
+     * Has no window, so it only asks to close once the frame limit from the settings is reached.
+     */
+    class SWRenderContext : public RenderContext
+    {
+    public:
+        static std::unique_ptr<RenderContext> getInstance(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings);
+
+        ~SWRenderContext() override;
+
+        // RenderContext
+        void init() override;
+        bool getInited() const override;
+        bool shouldClose() const override;
+        FrameContext &beginFrame() override;
+        void endFrame() override;
+
+        /**
+         * @brief Last completed frame.
+         */
+        const Framebuffer &getFramebuffer() const;
+
+    private:
+        SWRenderContext(const std::shared_ptr<Core::Logger> logger, const RenderSettings &settings);
+        const std::shared_ptr<Core::Logger> logger;
+        const RenderSettings settings;
+
+        bool isInited;
+        int frameCount;
+        Framebuffer framebuffer;
+        /// @brief Counters of the frame being rendered.
+        RenderStats frameStats;
+        /// @brief Counters of the last completed frame, exposed through the frame context.
+        RenderStats lastFrameStats;
+        std::chrono::steady_clock::time_point frameStart;
+        /// @brief World to view transform, the identity as there is no input to move it.
+        Camera camera;
+        const std::unique_ptr<SWRenderer> renderer;
+        const std::unique_ptr<FramePacer> pacer;
+        SWFrameContext frameContext;
+        /// @brief Encodes captured frames, null when capture is disabled.
+        std::unique_ptr<Capture::FrameWriter> frameWriter;
+
+        /**
+         * @brief Copies the finished frame into a pooled capture buffer.
+         */
+        void captureFrame();
+    };
+}
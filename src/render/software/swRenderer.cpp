@@ -0,0 +1,575 @@
+#include "swRenderer.hpp"
+#include "swFramebuffer.hpp"
+#include "swSpan.hpp"
+
+#include "../camera.hpp"
+#include "../text/_fonts.hpp"
+
+#include "../../core/logger.hpp"
+#include "../../core/point.hpp"
+#include "../../core/color.hpp"
+#include "../../core/densityGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AntColony::Render::Software
+{
+    namespace
+    {
+        constexpr const int TILE_SIZE = 64;
+
+        // Same extent as the GL circle quad, leaves room for the anti-aliased edge
+        constexpr const float CIRCLE_AA_MARGIN = 1.0f;
+        // Widest screen-space derivative of the circle distance, bounds the fully covered interior
+        constexpr const float MAX_CIRCLE_SMOOTHING = 1.41421356f;
+
+        // Distance field value on the glyph outline
+        constexpr const float GLYPH_EDGE = 0.5f;
+
+        constexpr const int TAB_CHAR = 9;
+        constexpr const int LINE_FEED_CHAR = 10;
+        constexpr const int RETURN_CHAR = 13;
+        constexpr const int SPACE_CHAR = 32;
+
+        // Clear colour shared with GLRenderer
+        constexpr const float CLEAR_CHANNEL = 0.1f;
+
+        inline float smoothstep(float edge0, float edge1, float x)
+        {
+            if (edge1 <= edge0)
+                return x < edge0 ? 0.0f : 1.0f;
+            const auto t = std::clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+            return t * t * (3.0f - 2.0f * t);
+        }
+
+        inline float mix(float a, float b, float t) { return a + (b - a) * t; }
+
+        inline bool isSpecialChar(char c)
+        {
+            return c == TAB_CHAR || c == LINE_FEED_CHAR || c == RETURN_CHAR || c == SPACE_CHAR;
+        }
+    }
+
+    SWRenderer::SWRenderer(const std::shared_ptr<Core::Logger> logger, unsigned int threadCount, RenderStats &stats, const Camera &camera)
+        : logger(logger),
+          stats(stats),
+          camera(camera),
+          workers(threadCount),
+          font(),
+          width(0),
+          height(0),
+          tilesX(0),
+          tilesY(0),
+          densityCount(0),
+          isStaticLayerValid(false),
+          staticLayerCameraRevision(camera.getRevision()),
+          isRecordingStaticLayer(false),
+          usesStaticLayer(false),
+          staticCommandCount(0),
+          isInited(false)
+    {
+        glyphIndex.fill(-1);
+    }
+
+    SWRenderer::~SWRenderer() = default;
+
+    bool SWRenderer::init()
+    {
+        if (!Text::FontAtlas::tryRead(MAIN_FONT_ATLAS, MAIN_FONT_ATLAS_LEN, font))
+        {
+            logger->error("Failed to initialize font: Invalid or outdated font atlas");
+            return false;
+        }
+
+        for (std::size_t i = 0; i < font.glyphs.size(); i++)
+        {
+            const auto codepoint = font.glyphs[i].codepoint;
+            if (codepoint >= 0 && codepoint < static_cast<int>(glyphIndex.size()))
+                glyphIndex[codepoint] = static_cast<int>(i);
+        }
+
+        logger->debug("Software renderer initialized with " + std::to_string(workers.getThreadCount()) + " threads");
+        isInited = true;
+        return true;
+    }
+
+    void SWRenderer::beginFrame(int frameWidth, int frameHeight)
+    {
+        width = frameWidth;
+        height = frameHeight;
+        tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+        tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+        if (staticLayer && (staticLayer->getWidth() != width || staticLayer->getHeight() != height))
+            isStaticLayerValid = false;
+
+        isRecordingStaticLayer = false;
+        usesStaticLayer = false;
+        staticCommandCount = 0;
+
+        commands.clear();
+        circles.clear();
+        glyphs.clear();
+        densityCount = 0;
+    }
+
+    void SWRenderer::pushCommand(COMMAND_TYPE type, std::uint32_t index, float minX, float minY, float maxX, float maxY)
+    {
+        const auto x0 = std::max(0, static_cast<int>(std::floor(minX)));
+        const auto y0 = std::max(0, static_cast<int>(std::floor(minY)));
+        const auto x1 = std::min(width, static_cast<int>(std::ceil(maxX)));
+        const auto y1 = std::min(height, static_cast<int>(std::ceil(maxY)));
+
+        if (x0 >= x1 || y0 >= y1)
+            return;
+
+        commands.push_back({type, index, x0, y0, x1, y1});
+    }
+
+    void SWRenderer::drawCircleInPosition(const Core::Point &position, const float radius, const Core::Color &color)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawCircleInPosition");
+            return;
+        }
+
+        // Same mapping as GLRenderer, world to normalized [-1,1] view to pixels with y pointing down
+        const auto viewPosition = camera.worldToView(position);
+        const auto x = (viewPosition.x + 1.0f) * 0.5f * width;
+        const auto y = (1.0f - viewPosition.y) * 0.5f * height;
+        const auto pixelRadius = camera.worldToView(radius) * (std::min(width, height) / 2.0f);
+
+        if (pixelRadius <= 0.0f)
+            return;
+
+        // Counted per Renderer call like the GL draw calls, not per binned command
+        stats.drawCalls++;
+
+        const auto extent = pixelRadius + CIRCLE_AA_MARGIN;
+        circles.push_back({x, y, pixelRadius, color.r, color.g, color.b});
+        pushCommand(CIRCLE, static_cast<std::uint32_t>(circles.size() - 1), x - extent, y - extent, x + extent, y + extent);
+    }
+
+    void SWRenderer::drawText(const Core::Point &position, const std::string &text, const Core::Color &color, const float fontSize)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawText");
+            return;
+        }
+
+        stats.drawCalls++;
+
+        const auto &header = font.header;
+        const auto pixelFontSize = fontSize * std::min(width, height) * 0.5f;
+        const auto sizeScale = pixelFontSize / header.size;
+        const auto fontScale = header.scale * sizeScale;
+
+        const auto x = (position.x + 1.0f) * 0.5f * width;
+        auto cursorX = x;
+        auto cursorY = (1.0f - position.y) * 0.5f * height;
+
+        for (const auto c : text)
+        {
+            const auto code = static_cast<unsigned char>(c);
+            if (code >= glyphIndex.size() || glyphIndex[code] < 0)
+            {
+                logger->error("Glyph not found for character: " + std::string(1, c));
+                continue;
+            }
+
+            const auto &glyph = font.glyphs[glyphIndex[code]];
+
+            if (isSpecialChar(c))
+            {
+                if (c == LINE_FEED_CHAR)
+                {
+                    cursorX = x;
+                    cursorY += header.lineHeight * sizeScale;
+                }
+                else if (c == RETURN_CHAR)
+                {
+                    cursorX = x;
+                }
+                else
+                {
+                    cursorX += static_cast<float>(glyph.advance) * fontScale;
+                }
+                continue;
+            }
+
+            const auto w = glyph.x1 - glyph.x0;
+            const auto h = glyph.y1 - glyph.y0;
+            if (w > 0 && h > 0)
+            {
+                // Same placement as GLTextRenderer::tryAddGlyphVertices
+                const auto x0 = cursorX + static_cast<float>(glyph.x0) * sizeScale;
+                const auto y0 = cursorY + (static_cast<float>(glyph.y0) - header.ascent * header.scale) * sizeScale;
+                const auto x1 = x0 + static_cast<float>(w) * sizeScale;
+                const auto y1 = y0 + static_cast<float>(h) * sizeScale;
+
+                glyphs.push_back({x0, y0, x1, y1,
+                                  static_cast<float>(glyph.tex_x), static_cast<float>(glyph.tex_y),
+                                  1.0f / sizeScale,
+                                  color.r, color.g, color.b});
+                pushCommand(GLYPH, static_cast<std::uint32_t>(glyphs.size() - 1), x0, y0, x1, y1);
+            }
+
+            cursorX += static_cast<float>(glyph.advance) * fontScale;
+        }
+    }
+
+    void SWRenderer::drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawDensityGrid");
+            return;
+        }
+
+        pushGrid(grid, color, false);
+    }
+
+    void SWRenderer::drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping drawCoverageGrid");
+            return;
+        }
+
+        pushGrid(grid, color, true);
+    }
+
+    void SWRenderer::pushGrid(const Core::DensityGrid &grid, const Core::Color &color, bool isCoverage)
+    {
+        if (grid.width <= 0 || grid.height <= 0 || grid.maxValue <= 0.0f)
+            return;
+
+        if (densityCount == densities.size())
+            densities.emplace_back();
+
+        auto &density = densities[densityCount];
+        const auto min = camera.worldToView(Core::Point(grid.area.minX, grid.area.minY));
+        const auto max = camera.worldToView(Core::Point(grid.area.maxX, grid.area.maxY));
+        density.x0 = (min.x + 1.0f) * 0.5f * width;
+        density.x1 = (max.x + 1.0f) * 0.5f * width;
+        density.y0 = (1.0f - max.y) * 0.5f * height;
+        density.y1 = (1.0f - min.y) * 0.5f * height;
+        density.width = grid.width;
+        density.height = grid.height;
+        density.cells.assign(grid.cells.begin(), grid.cells.end());
+        stats.drawCalls++;
+        stats.bufferUploads++;
+        stats.uploadedBytes += grid.cells.size() * sizeof(float);
+        density.maxValue = grid.maxValue;
+        density.r = color.r;
+        density.g = color.g;
+        density.b = color.b;
+        density.isCoverage = isCoverage;
+
+        pushCommand(DENSITY, static_cast<std::uint32_t>(densityCount), density.x0, density.y0, density.x1, density.y1);
+        densityCount++;
+    }
+
+    void SWRenderer::rasterise(Framebuffer &framebuffer)
+    {
+        if (framebuffer.getWidth() != width || framebuffer.getHeight() != height)
+        {
+            logger->error("Framebuffer size does not match the frame, skipping rasterise");
+            return;
+        }
+
+        const auto tileCount = static_cast<std::size_t>(tilesX) * tilesY;
+
+        // The layer is redrawn only in frames that recorded its commands
+        if (usesStaticLayer && !isStaticLayerValid)
+        {
+            if (!staticLayer || staticLayer->getWidth() != width || staticLayer->getHeight() != height)
+                staticLayer = std::make_unique<Framebuffer>(width, height);
+
+            binCommands(0, staticCommandCount);
+            workers.parallelFor(tileCount, [this](std::size_t tile)
+                                { rasteriseTile(tile, *staticLayer, nullptr); });
+            isStaticLayerValid = true;
+        }
+
+        const auto *background = usesStaticLayer ? staticLayer.get() : nullptr;
+        binCommands(staticCommandCount, commands.size());
+        workers.parallelFor(tileCount, [this, &framebuffer, background](std::size_t tile)
+                            { rasteriseTile(tile, framebuffer, background); });
+    }
+
+    bool SWRenderer::beginStaticLayer()
+    {
+        if (!isInited)
+        {
+            logger->error("Renderer not initialized, skipping beginStaticLayer");
+            return false;
+        }
+
+        if (!commands.empty())
+            logger->warning("Static layer started after other draws, they are drawn into the layer");
+
+        // The layer holds world geometry, a moved camera changes its contents
+        if (camera.getRevision() != staticLayerCameraRevision)
+        {
+            isStaticLayerValid = false;
+            staticLayerCameraRevision = camera.getRevision();
+        }
+
+        isRecordingStaticLayer = !isStaticLayerValid;
+        return isRecordingStaticLayer;
+    }
+
+    void SWRenderer::endStaticLayer()
+    {
+        if (!isInited)
+            return;
+
+        if (isRecordingStaticLayer)
+            staticCommandCount = commands.size();
+
+        isRecordingStaticLayer = false;
+        usesStaticLayer = true;
+    }
+
+    void SWRenderer::invalidateStaticLayer() { isStaticLayerValid = false; }
+
+    void SWRenderer::binCommands(std::size_t first, std::size_t last)
+    {
+        const auto tileCount = static_cast<std::size_t>(tilesX) * tilesY;
+        if (tileCommands.size() < tileCount)
+            tileCommands.resize(tileCount);
+
+        for (auto &tile : tileCommands)
+            tile.clear();
+
+        for (auto i = first; i < last; i++)
+        {
+            const auto &command = commands[i];
+            const auto tileX1 = (command.maxX - 1) / TILE_SIZE;
+            const auto tileY1 = (command.maxY - 1) / TILE_SIZE;
+
+            for (auto ty = command.minY / TILE_SIZE; ty <= tileY1; ty++)
+            {
+                for (auto tx = command.minX / TILE_SIZE; tx <= tileX1; tx++)
+                    tileCommands[ty * tilesX + tx].push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    void SWRenderer::rasteriseTile(std::size_t tile, Framebuffer &framebuffer, const Framebuffer *background) const
+    {
+        const auto tx = static_cast<int>(tile % tilesX);
+        const auto ty = static_cast<int>(tile / tilesX);
+        const TileRect rect{
+            tx * TILE_SIZE,
+            ty * TILE_SIZE,
+            std::min(width, (tx + 1) * TILE_SIZE),
+            std::min(height, (ty + 1) * TILE_SIZE)};
+
+        if (background)
+        {
+            for (auto y = rect.minY; y < rect.maxY; y++)
+                std::copy(background->getRow(y) + rect.minX, background->getRow(y) + rect.maxX, framebuffer.getRow(y) + rect.minX);
+        }
+        else
+        {
+            const auto clearColor = packColor(CLEAR_CHANNEL, CLEAR_CHANNEL, CLEAR_CHANNEL);
+            for (auto y = rect.minY; y < rect.maxY; y++)
+                fillSpan(framebuffer.getRow(y) + rect.minX, rect.maxX - rect.minX, clearColor);
+        }
+
+        for (const auto index : tileCommands[tile])
+        {
+            const auto &command = commands[index];
+            const TileRect clipped{
+                std::max(rect.minX, command.minX),
+                std::max(rect.minY, command.minY),
+                std::min(rect.maxX, command.maxX),
+                std::min(rect.maxY, command.maxY)};
+
+            switch (command.type)
+            {
+            case CIRCLE:
+                rasteriseCircle(circles[command.index], clipped, framebuffer);
+                break;
+            case GLYPH:
+                rasteriseGlyph(glyphs[command.index], clipped, framebuffer);
+                break;
+            case DENSITY:
+                rasteriseDensity(densities[command.index], clipped, framebuffer);
+                break;
+            }
+        }
+    }
+
+    void SWRenderer::rasteriseCircle(const CircleCommand &circle, const TileRect &rect, Framebuffer &framebuffer) const
+    {
+        const auto solid = packColor(circle.r, circle.g, circle.b);
+        const auto radius = circle.radius;
+        const auto innerRadius = radius - MAX_CIRCLE_SMOOTHING;
+
+        for (auto y = rect.minY; y < rect.maxY; y++)
+        {
+            const auto dy = static_cast<float>(y) + 0.5f - circle.y;
+            if (std::fabs(dy) >= radius)
+                continue;
+
+            auto *row = framebuffer.getRow(y);
+
+            // Pixels whose centres are far enough inside are fully covered and filled as one span
+            auto innerStart = rect.maxX;
+            auto innerEnd = rect.maxX;
+            if (innerRadius > std::fabs(dy))
+            {
+                const auto halfWidth = std::sqrt(innerRadius * innerRadius - dy * dy);
+                innerStart = std::clamp(static_cast<int>(std::ceil(circle.x - halfWidth - 0.5f)), rect.minX, rect.maxX);
+                innerEnd = std::clamp(static_cast<int>(std::floor(circle.x + halfWidth - 0.5f)) + 1, innerStart, rect.maxX);
+            }
+
+            // Distance-shaded edge, same falloff as CIRCLE_FRAGMENT_SHADER_SOURCE
+            const auto shadeEdge = [&](int x)
+            {
+                const auto dx = static_cast<float>(x) + 0.5f - circle.x;
+                const auto distance = std::sqrt(dx * dx + dy * dy);
+                if (distance >= radius)
+                    return;
+
+                const auto smoothing = distance > 0.0f ? (std::fabs(dx) + std::fabs(dy)) / distance : 1.0f;
+                const auto alpha = 1.0f - smoothstep(radius - smoothing, radius, distance);
+                if (alpha >= 1.0f)
+                    row[x] = solid;
+                else if (alpha > 0.0f)
+                    blendPixel(row[x], circle.r, circle.g, circle.b, alpha);
+            };
+
+            for (auto x = rect.minX; x < innerStart; x++)
+                shadeEdge(x);
+
+            fillSpan(row + innerStart, innerEnd - innerStart, solid);
+
+            for (auto x = innerEnd; x < rect.maxX; x++)
+                shadeEdge(x);
+        }
+    }
+
+    float SWRenderer::sampleFont(float u, float v) const
+    {
+        const auto &header = font.header;
+        const auto fx = u - 0.5f;
+        const auto fy = v - 0.5f;
+        const auto x0 = static_cast<int>(std::floor(fx));
+        const auto y0 = static_cast<int>(std::floor(fy));
+        const auto tx = fx - static_cast<float>(x0);
+        const auto ty = fy - static_cast<float>(y0);
+
+        const auto texel = [&](int x, int y)
+        {
+            x = std::clamp(x, 0, header.width - 1);
+            y = std::clamp(y, 0, header.height - 1);
+            return static_cast<float>(font.bitmap[y * header.width + x]);
+        };
+
+        const auto top = mix(texel(x0, y0), texel(x0 + 1, y0), tx);
+        const auto bottom = mix(texel(x0, y0 + 1), texel(x0 + 1, y0 + 1), tx);
+        return mix(top, bottom, ty) / 255.0f;
+    }
+
+    void SWRenderer::rasteriseGlyph(const GlyphCommand &glyph, const TileRect &rect, Framebuffer &framebuffer) const
+    {
+        const auto step = glyph.texelsPerPixel;
+
+        for (auto y = rect.minY; y < rect.maxY; y++)
+        {
+            const auto centerY = static_cast<float>(y) + 0.5f;
+            if (centerY < glyph.y0 || centerY >= glyph.y1)
+                continue;
+
+            auto *row = framebuffer.getRow(y);
+            const auto v = glyph.texY + (centerY - glyph.y0) * step;
+
+            for (auto x = rect.minX; x < rect.maxX; x++)
+            {
+                const auto centerX = static_cast<float>(x) + 0.5f;
+                if (centerX < glyph.x0 || centerX >= glyph.x1)
+                    continue;
+
+                const auto u = glyph.texX + (centerX - glyph.x0) * step;
+
+                // Screen-space derivative like fwidth() in TEXT_FRAGMENT_SHADER_SOURCE
+                const auto distance = sampleFont(u, v);
+                const auto smoothing = std::fabs(sampleFont(u + step, v) - distance) + std::fabs(sampleFont(u, v + step) - distance);
+                const auto alpha = smoothstep(GLYPH_EDGE - smoothing, GLYPH_EDGE + smoothing, distance);
+
+                if (alpha > 0.0f)
+                    blendPixel(row[x], glyph.r, glyph.g, glyph.b, alpha);
+            }
+        }
+    }
+
+    void SWRenderer::rasteriseDensity(const DensityCommand &density, const TileRect &rect, Framebuffer &framebuffer) const
+    {
+        const auto quadWidth = density.x1 - density.x0;
+        const auto quadHeight = density.y1 - density.y0;
+        if (quadWidth <= 0.0f || quadHeight <= 0.0f)
+            return;
+
+        const auto cell = [&](int x, int y)
+        {
+            x = std::clamp(x, 0, density.width - 1);
+            y = std::clamp(y, 0, density.height - 1);
+            return density.cells[y * density.width + x];
+        };
+
+        for (auto y = rect.minY; y < rect.maxY; y++)
+        {
+            const auto centerY = static_cast<float>(y) + 0.5f;
+            if (centerY < density.y0 || centerY >= density.y1)
+                continue;
+
+            auto *row = framebuffer.getRow(y);
+
+            // Row 0 of the grid is at the bottom of the quad
+            const auto fy = (density.y1 - centerY) / quadHeight * density.height - 0.5f;
+            const auto cy = static_cast<int>(std::floor(fy));
+            const auto ty = fy - static_cast<float>(cy);
+
+            for (auto x = rect.minX; x < rect.maxX; x++)
+            {
+                const auto centerX = static_cast<float>(x) + 0.5f;
+                if (centerX < density.x0 || centerX >= density.x1)
+                    continue;
+
+                const auto fx = (centerX - density.x0) / quadWidth * density.width - 0.5f;
+                const auto cx = static_cast<int>(std::floor(fx));
+                const auto tx = fx - static_cast<float>(cx);
+
+                const auto value = mix(mix(cell(cx, cy), cell(cx + 1, cy), tx), mix(cell(cx, cy + 1), cell(cx + 1, cy + 1), tx), ty);
+                const auto normalized = std::clamp(value / density.maxValue, 0.0f, 1.0f);
+                if (normalized <= 0.0f)
+                    continue;
+
+                // Same as COVERAGE_FRAGMENT_SHADER_SOURCE
+                if (density.isCoverage)
+                {
+                    blendPixel(row[x], density.r, density.g, density.b, normalized);
+                    continue;
+                }
+
+                // Same ramp as DENSITY_FRAGMENT_SHADER_SOURCE
+                const auto level = std::sqrt(normalized);
+                const auto base = smoothstep(0.0f, 0.6f, level);
+                const auto highlight = smoothstep(0.6f, 1.0f, level);
+                const auto r = mix(mix(density.r * 0.4f, density.r, base), 1.0f, highlight);
+                const auto g = mix(mix(density.g * 0.4f, density.g, base), 1.0f, highlight);
+                const auto b = mix(mix(density.b * 0.4f, density.b, base), 1.0f, highlight);
+
+                blendPixel(row[x], r, g, b, smoothstep(0.0f, 0.2f, level));
+            }
+        }
+    }
+}
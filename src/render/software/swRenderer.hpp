@@ -0,0 +1,185 @@
+#pragma once
+#include "_fwd.hpp"
+#include "../_fwd.hpp"
+#include "../../core/_fwd.hpp"
+
+#include "../renderer.hpp"
+#include "../renderStats.hpp"
+#include "../text/fontAtlas.hpp"
+#include "../../utils/workerPool.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AntColony::Render::Software
+{
+    /**
+     * @brief CPU renderer producing the same image as GLRenderer at the same resolution.
+     *
+     * Draw calls only record commands. rasterise() bins them into screen tiles and shades the tiles
+     * in parallel, each tile replaying its commands in submission order so blending matches GL.
+     */
+    class SWRenderer : public Renderer
+    {
+    public:
+        /**
+         * @brief Constructor with a logger and the number of rasterisation threads.
+         * @param logger Shared pointer to the logger instance.
+         * @param threadCount Rasterisation threads, 0 selects the hardware concurrency.
+         * @param stats Counters of the current frame, owned by the render context.
+         * @param camera Maps world positions to the view, owned by the render context.
+         */
+        SWRenderer(const std::shared_ptr<Core::Logger> logger, unsigned int threadCount, RenderStats &stats, const Camera &camera);
+
+        ~SWRenderer() override;
+
+        /**
+         * @brief Loads the font atlas baked at build time.
+         * @return True if the renderer is ready to draw.
+         */
+        bool init();
+
+        /**
+         * @brief Drops the commands of the previous frame and sets the target size.
+         * @param width Target width in pixels.
+         * @param height Target height in pixels.
+         */
+        void beginFrame(int width, int height);
+
+        /**
+         * @brief Clears the framebuffer and rasterises all commands recorded since beginFrame.
+         * @param framebuffer Target, must match the size passed to beginFrame.
+         */
+        void rasterise(Framebuffer &framebuffer);
+
+        // Renderer
+        void drawCircleInPosition(const Core::Point &position, const float radius, const Core::Color &color) override;
+        void drawText(const Core::Point &position, const std::string &text, const Core::Color &color, const float fontSize) override;
+        void drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color) override;
+        void drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color) override;
+        bool beginStaticLayer() override;
+        void endStaticLayer() override;
+        void invalidateStaticLayer() override;
+
+    private:
+        enum COMMAND_TYPE
+        {
+            CIRCLE,
+            GLYPH,
+            DENSITY,
+        };
+
+        /// @brief Recorded draw in submission order with its clipped pixel bounds.
+        struct DrawCommand
+        {
+            COMMAND_TYPE type;
+            std::uint32_t index;
+            int minX, minY, maxX, maxY;
+        };
+
+        /// @brief Circle in pixel coordinates.
+        struct CircleCommand
+        {
+            float x, y, radius;
+            float r, g, b;
+        };
+
+        /// @brief Glyph quad in pixel coordinates with its atlas origin.
+        struct GlyphCommand
+        {
+            float x0, y0, x1, y1;
+            float texX, texY;
+            float texelsPerPixel;
+            float r, g, b;
+        };
+
+        /// @brief Copy of a density grid with its quad in pixel coordinates.
+        struct DensityCommand
+        {
+            float x0, y0, x1, y1;
+            int width, height;
+            std::vector<float> cells;
+            float maxValue;
+            float r, g, b;
+            /// @brief Draws the normalized value as opacity in a flat color instead of the density ramp.
+            bool isCoverage;
+        };
+
+        /// @brief Pixel rectangle of a tile, max bounds exclusive.
+        struct TileRect
+        {
+            int minX, minY, maxX, maxY;
+        };
+
+        /// @brief Shared pointer to the logger for error reporting.
+        const std::shared_ptr<Core::Logger> logger;
+        /// @brief Counters of the current frame.
+        RenderStats &stats;
+        /// @brief World to view transform.
+        const Camera &camera;
+        /// @brief Threads shading tiles.
+        Utils::WorkerPool workers;
+        /// @brief Baked signed distance field font.
+        Text::FontAtlas font;
+        /// @brief Index into font.glyphs per ASCII code, -1 if missing.
+        std::array<int, 128> glyphIndex;
+
+        int width;
+        int height;
+        int tilesX;
+        int tilesY;
+
+        std::vector<DrawCommand> commands;
+        std::vector<CircleCommand> circles;
+        std::vector<GlyphCommand> glyphs;
+        /// @brief Density commands are reused between frames to keep their cell storage.
+        std::vector<DensityCommand> densities;
+        std::size_t densityCount;
+        /// @brief Command indices per tile, kept between frames to avoid reallocations.
+        std::vector<std::vector<std::uint32_t>> tileCommands;
+
+        /// @brief Cached static layer, copied into each tile instead of the clear colour.
+        std::unique_ptr<Framebuffer> staticLayer;
+        /// @brief Whether staticLayer holds the current layer contents at the current size.
+        bool isStaticLayerValid;
+        /// @brief Camera revision the static layer was drawn with.
+        std::uint32_t staticLayerCameraRevision;
+        /// @brief Whether draws currently go into the static layer.
+        bool isRecordingStaticLayer;
+        /// @brief Whether the frame composites the static layer.
+        bool usesStaticLayer;
+        /// @brief Commands before this index belong to the static layer, recorded only when it is redrawn.
+        std::size_t staticCommandCount;
+
+        /// @brief Tracks initialization state.
+        bool isInited;
+
+        void pushCommand(COMMAND_TYPE type, std::uint32_t index, float minX, float minY, float maxX, float maxY);
+
+        /**
+         * @brief Copies a density or coverage grid into a reused density command.
+         */
+        void pushGrid(const Core::DensityGrid &grid, const Core::Color &color, bool isCoverage);
+        /**
+         * @brief Bins the commands in [first, last) into tiles.
+         */
+        void binCommands(std::size_t first, std::size_t last);
+
+        /**
+         * @brief Fills a tile from the background, or the clear colour if there is none, then draws its commands.
+         */
+        void rasteriseTile(std::size_t tile, Framebuffer &framebuffer, const Framebuffer *background) const;
+
+        void rasteriseCircle(const CircleCommand &circle, const TileRect &rect, Framebuffer &framebuffer) const;
+        void rasteriseGlyph(const GlyphCommand &glyph, const TileRect &rect, Framebuffer &framebuffer) const;
+        void rasteriseDensity(const DensityCommand &density, const TileRect &rect, Framebuffer &framebuffer) const;
+
+        /**
+         * @brief Bilinear atlas lookup with clamp-to-edge, in texel units, returns the distance in [0, 1].
+         */
+        float sampleFont(float u, float v) const;
+    };
+}
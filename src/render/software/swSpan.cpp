@@ -0,0 +1,58 @@
+#include "swSpan.hpp"
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace AntColony::Render::Software
+{
+    namespace
+    {
+        constexpr const Pixel OPAQUE_ALPHA = 0xFF000000u;
+
+        inline Pixel toChannel(float value)
+        {
+            return static_cast<Pixel>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+    }
+
+    Pixel packColor(float r, float g, float b)
+    {
+        return OPAQUE_ALPHA | (toChannel(b) << 16) | (toChannel(g) << 8) | toChannel(r);
+    }
+
+    void fillSpan(Pixel *dst, int count, Pixel color)
+    {
+        auto i = 0;
+#if defined(__SSE2__)
+        const auto value = _mm_set1_epi32(static_cast<int>(color));
+        for (; i + 8 <= count; i += 8)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), value);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), value);
+        }
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), value);
+#elif defined(__ARM_NEON)
+        const auto value = vdupq_n_u32(color);
+        for (; i + 4 <= count; i += 4)
+            vst1q_u32(dst + i, value);
+#endif
+        for (; i < count; i++)
+            dst[i] = color;
+    }
+
+    void blendPixel(Pixel &dst, float r, float g, float b, float alpha)
+    {
+        const auto inverse = 1.0f - alpha;
+        const auto dstR = static_cast<float>(dst & 0xFF) / 255.0f;
+        const auto dstG = static_cast<float>((dst >> 8) & 0xFF) / 255.0f;
+        const auto dstB = static_cast<float>((dst >> 16) & 0xFF) / 255.0f;
+
+        dst = packColor(r * alpha + dstR * inverse, g * alpha + dstG * inverse, b * alpha + dstB * inverse);
+    }
+}
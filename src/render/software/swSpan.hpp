@@ -0,0 +1,21 @@
+#pragma once
+
+#include "swFramebuffer.hpp"
+
+namespace AntColony::Render::Software
+{
+    /**
+     * @brief Packs a colour with channels in [0, 1] into an opaque pixel.
+     */
+    Pixel packColor(float r, float g, float b);
+
+    /**
+     * @brief Writes the same pixel over a span, four pixels per store where SIMD is available.
+     */
+    void fillSpan(Pixel *dst, int count, Pixel color);
+
+    /**
+     * @brief Blends a colour over a single pixel with source-over alpha, matching GL_SRC_ALPHA blending.
+     */
+    void blendPixel(Pixel &dst, float r, float g, float b, float alpha);
+}
@@ -0,0 +1,77 @@
+#include "statsReport.hpp"
+#include "renderer.hpp"
+#include "renderStats.hpp"
+
+#include "../core/color.hpp"
+#include "../core/logger.hpp"
+#include "../core/point.hpp"
+
+#include <cinttypes>
+
+namespace AntColony::Render
+{
+    namespace
+    {
+        constexpr const char *STDOUT_PATH = "-";
+
+        constexpr const float OVERLAY_X = -0.95f;
+        constexpr const float OVERLAY_Y = -0.72f;
+        constexpr const float OVERLAY_FONT_SIZE = 0.05f;
+        constexpr const unsigned int OVERLAY_COLOR = 0xc8c8c8;
+    }
+
+    void drawStatsOverlay(Renderer &renderer, const RenderStats &stats)
+    {
+        char text[256];
+        std::snprintf(text, sizeof(text),
+                      "Frame %.2f ms, submit %.2f ms\n"
+                      "Draws %" PRIu32 ", uniforms %" PRIu32 "\n"
+                      "Binds: program %" PRIu32 ", VAO %" PRIu32 ", texture %" PRIu32 "\n"
+                      "Uploads %" PRIu32 ", %.1f KiB",
+                      stats.frameTime, stats.submitTime,
+                      stats.drawCalls, stats.uniformUploads,
+                      stats.programBinds, stats.vertexArrayBinds, stats.textureBinds,
+                      stats.bufferUploads, static_cast<double>(stats.uploadedBytes) / 1024.0);
+
+        renderer.drawText(Core::Point(OVERLAY_X, OVERLAY_Y), text, Core::Color(OVERLAY_COLOR), OVERLAY_FONT_SIZE);
+    }
+
+    StatsJsonWriter::StatsJsonWriter(const std::string &path, std::shared_ptr<Core::Logger> logger)
+        : output(nullptr),
+          ownsOutput(false)
+    {
+        if (path == STDOUT_PATH)
+        {
+            output = stdout;
+        }
+        else
+        {
+            output = std::fopen(path.c_str(), "w");
+            ownsOutput = true;
+        }
+
+        if (!output)
+            logger->error("Failed to open stats output: " + path);
+    }
+
+    StatsJsonWriter::~StatsJsonWriter()
+    {
+        if (output && ownsOutput)
+            std::fclose(output);
+        else if (output)
+            std::fflush(output);
+    }
+
+    bool StatsJsonWriter::isOpen() const { return output != nullptr; }
+
+    void StatsJsonWriter::write(std::uint64_t frameIndex, const RenderStats &stats)
+    {
+        std::fprintf(output,
+                     "{\"frame\":%" PRIu64 ",\"drawCalls\":%" PRIu32 ",\"programBinds\":%" PRIu32
+                     ",\"vertexArrayBinds\":%" PRIu32 ",\"textureBinds\":%" PRIu32 ",\"uniformUploads\":%" PRIu32
+                     ",\"bufferUploads\":%" PRIu32 ",\"uploadedBytes\":%" PRIu64 ",\"submitTimeMs\":%.4f,\"frameTimeMs\":%.4f}\n",
+                     frameIndex, stats.drawCalls, stats.programBinds,
+                     stats.vertexArrayBinds, stats.textureBinds, stats.uniformUploads,
+                     stats.bufferUploads, stats.uploadedBytes, stats.submitTime, stats.frameTime);
+    }
+}
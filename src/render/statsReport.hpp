@@ -0,0 +1,49 @@
+#pragma once
+
+#include "_fwd.hpp"
+#include "../core/_fwd.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace AntColony::Render
+{
+    /**
+     * @brief Draws frame statistics as text in the bottom-left corner.
+     * @param renderer Renderer of the current frame.
+     * @param stats Statistics to show, usually those of the previous frame.
+     */
+    void drawStatsOverlay(Renderer &renderer, const RenderStats &stats);
+
+    /**
+     * @brief Writes frame statistics as JSON Lines, one object per frame.
+     */
+    class StatsJsonWriter
+    {
+    public:
+        /**
+         * @brief Opens the output.
+         * @param path Output file, "-" writes to stdout.
+         * @param logger Shared pointer to the logger instance.
+         */
+        StatsJsonWriter(const std::string &path, std::shared_ptr<Core::Logger> logger);
+
+        ~StatsJsonWriter();
+
+        StatsJsonWriter(const StatsJsonWriter &) = delete;
+        StatsJsonWriter &operator=(const StatsJsonWriter &) = delete;
+
+        bool isOpen() const;
+
+        /**
+         * @brief Appends the statistics of a completed frame.
+         */
+        void write(std::uint64_t frameIndex, const RenderStats &stats);
+
+    private:
+        std::FILE *output;
+        bool ownsOutput;
+    };
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <cstddef>
+
+// Baked at build time by AntColonyFontBaker, see tools/fontBaker
+extern const unsigned char MAIN_FONT_ATLAS[];
+extern const std::size_t MAIN_FONT_ATLAS_LEN;
@@ -0,0 +1,6 @@
+namespace AntColony::Render::Text
+{
+    struct FontAtlasHeader;
+    struct BakedGlyph;
+    struct FontAtlas;
+}
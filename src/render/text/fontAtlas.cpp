@@ -0,0 +1,32 @@
+#include "fontAtlas.hpp"
+
+#include <cstring>
+
+namespace AntColony::Render::Text
+{
+    bool FontAtlas::tryRead(const unsigned char *data, std::size_t length, FontAtlas &atlas)
+    {
+        if (!data || length < sizeof(FontAtlasHeader))
+            return false;
+
+        // Blob is a plain byte array, copy instead of casting to avoid alignment assumptions
+        std::memcpy(&atlas.header, data, sizeof(FontAtlasHeader));
+        const auto &header = atlas.header;
+
+        if (header.magic != FONT_ATLAS_MAGIC || header.version != FONT_ATLAS_VERSION)
+            return false;
+
+        if (header.width <= 0 || header.height <= 0)
+            return false;
+
+        const auto glyphsSize = static_cast<std::size_t>(header.glyphCount) * sizeof(BakedGlyph);
+        const auto bitmapSize = static_cast<std::size_t>(header.width) * static_cast<std::size_t>(header.height);
+        if (length != sizeof(FontAtlasHeader) + glyphsSize + bitmapSize)
+            return false;
+
+        atlas.glyphs.resize(header.glyphCount);
+        std::memcpy(atlas.glyphs.data(), data + sizeof(FontAtlasHeader), glyphsSize);
+        atlas.bitmap = data + sizeof(FontAtlasHeader) + glyphsSize;
+        return true;
+    }
+}
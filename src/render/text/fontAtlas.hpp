@@ -0,0 +1,89 @@
+#pragma once
+
+#include "_fwd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AntColony::Render::Text
+{
+    /// @brief Identifies a baked font atlas blob ('ATLS').
+    constexpr const std::uint32_t FONT_ATLAS_MAGIC = 0x534C5441;
+    /// @brief Version of the blob layout, bumped on every layout change.
+    constexpr const std::uint32_t FONT_ATLAS_VERSION = 1;
+
+    /**
+     * @brief Header of a baked font atlas blob.
+     *
+     * Blob layout: header, followed by glyphCount glyphs, followed by width * height atlas bytes.
+     */
+    struct FontAtlasHeader
+    {
+        /// @brief Must be FONT_ATLAS_MAGIC.
+        std::uint32_t magic;
+        /// @brief Must be FONT_ATLAS_VERSION.
+        std::uint32_t version;
+        /// @brief Font size in pixels the atlas was rasterised at.
+        float size;
+        /// @brief Scaling factor from font units to pixels at the baked size.
+        float scale;
+        /// @brief Line height in pixels at the baked size.
+        float lineHeight;
+        /// @brief Font ascent in font units.
+        std::int32_t ascent;
+        /// @brief Font descent in font units.
+        std::int32_t descent;
+        /// @brief Line gap in font units.
+        std::int32_t lineGap;
+        /// @brief Width of the atlas bitmap.
+        std::int32_t width;
+        /// @brief Height of the atlas bitmap.
+        std::int32_t height;
+        /// @brief Number of glyphs following the header.
+        std::uint32_t glyphCount;
+        /// @brief Non-zero when the atlas stores signed distance fields.
+        std::uint32_t sdf;
+    };
+
+    /**
+     * @brief Glyph metrics as stored in the blob.
+     */
+    struct BakedGlyph
+    {
+        /// @brief Character code.
+        std::int32_t codepoint;
+        /// @brief Glyph advance width in font units.
+        std::int32_t advance;
+        /// @brief Left side bearing in font units.
+        std::int32_t lsb;
+        /// @brief X-coordinate of the glyph in the atlas.
+        std::int32_t tex_x;
+        /// @brief Y-coordinate of the glyph in the atlas.
+        std::int32_t tex_y;
+        /// @brief Bitmap box relative to the pen position, in pixels at the baked size.
+        std::int32_t x0, y0, x1, y1;
+    };
+
+    /**
+     * @brief Parsed view over a baked font atlas blob.
+     */
+    struct FontAtlas
+    {
+        /// @brief Copy of the blob header.
+        FontAtlasHeader header;
+        /// @brief Copy of the glyph table.
+        std::vector<BakedGlyph> glyphs;
+        /// @brief Atlas bitmap, points into the blob.
+        const unsigned char *bitmap;
+
+        /**
+         * @brief Parses a baked blob without copying the bitmap.
+         * @param data Blob data.
+         * @param length Blob length in bytes.
+         * @param atlas Parsed atlas.
+         * @return True if the blob is complete and matches the current layout version.
+         */
+        static bool tryRead(const unsigned char *data, std::size_t length, FontAtlas &atlas);
+    };
+}
@@ -11,7 +11,8 @@ namespace AntColony::Simulation
           carryFood(false),
           pheromoneExcitement(0),
           pheromoneCharge(0),
-          pheromoneChargeThreshold(pheromoneThreshold) {}
+          pheromoneChargeThreshold(pheromoneThreshold),
+          nextPheromonPosition(0.0f, 0.0f) {}
 
     Ant::Ant(Core::Point position, Core::Point velocity, float size, int pheromoneThreshold)
         : BaseEntity(position, 0xfc6203, size),
@@ -19,15 +20,13 @@ namespace AntColony::Simulation
           carryFood(false),
           pheromoneExcitement(0),
           pheromoneCharge(0),
-          pheromoneChargeThreshold(pheromoneThreshold) {}
+          pheromoneChargeThreshold(pheromoneThreshold),
+          nextPheromonPosition(0.0f, 0.0f) {}
 
-    void Ant::biteFood(std::shared_ptr<Food> food)
+    void Ant::biteFood(const Food &food)
     {
         if (!carryFood)
         {
-            // Reduce food capacity
-            food->take();
-
             // Start carrying
             carryFood = true;
 
@@ -35,14 +34,14 @@ namespace AntColony::Simulation
             velocity *= 0;
 
             // Start spawning if there is more food
-            pheromoneExcitement = food.get()->getCapacity();
+            pheromoneExcitement = food.getCapacity();
 
             // Immediate spawn
             pheromoneCharge = pheromoneChargeThreshold;
 
             // Calculate and store collision point - at the edge of the ant body facing the food
-            auto directionToFood = food->getPosition() - position;
-            auto distance = position.distanceTo(food->getPosition());
+            auto directionToFood = food.getPosition() - position;
+            auto distance = position.distanceTo(food.getPosition());
 
             if (distance > 0)
             {
@@ -111,4 +110,5 @@ namespace AntColony::Simulation
 
     Core::Point Ant::getPosition() const { return position; }
     float Ant::getSize() const { return entitySize; }
+    unsigned int Ant::getColor() const { return mainColor; }
 }
\ No newline at end of file
@@ -19,7 +19,11 @@ namespace AntColony::Simulation
 
         void render(Render::Renderer &renderer) override;
 
-        void biteFood(std::shared_ptr<Food> food);
+        /**
+         * @brief Starts carrying a portion taken from the food
+         * @param food The food after the portion was taken
+         */
+        void biteFood(const Food &food);
         void dropFood();
         bool trySpawnPheromone();
 
@@ -34,6 +38,7 @@ namespace AntColony::Simulation
 
         Core::Point getPosition() const override;
         float getSize() const override;
+        unsigned int getColor() const;
 
     private:
         // Stores previous movement direction
@@ -3,6 +3,11 @@
 
 #include "antManager.hpp"
 
+#include "../core/color.hpp"
+#include "../core/morton.hpp"
+#include "../render/camera.hpp"
+#include "../utils/radixSort.hpp"
+
 #include <algorithm>
 #include <cmath>
 
@@ -18,12 +23,26 @@ namespace AntColony::Simulation
     constexpr auto VELOCITY_SCALING_THRESHOLD = 0.1f;
     constexpr auto MAX_POSITION_ATTEMPTS = 10;
     constexpr auto PHEROMONE_CHARGE_THRESHOLD = 30;
+    // Longest step of an ant per movement attempt, a repulsion at the largest unnormalised magnitude
+    constexpr auto MAX_ANT_STEP = MAX_REPULSION_MAGNITUDE * REPULSION_SCALING;
+    // Margin of the neighbour lists in ant sizes, an ant moving half of it triggers a rebuild
+    constexpr auto NEIGHBOUR_LIST_SKIN = 2.0f;
+
+    // Ants with a smaller radius on screen are splatted instead of drawn
+    constexpr auto LOD_PIXEL_RADIUS = 1.0f;
+    // Side of a splat grid cell in pixels
+    constexpr auto SPLAT_CELL_PIXELS = 2;
 
     AntManager::AntManager(Core::ViewPort viewPort)
         : AntManager(std::make_shared<Utils::ConsoleLogger>(), viewPort) {}
 
     AntManager::AntManager(std::shared_ptr<Core::Logger> logger, Core::ViewPort viewPort)
-        : BaseEntityManager(logger), viewPort(viewPort) {}
+        : BaseEntityManager(logger),
+          viewPort(viewPort),
+          listRadius(0.0f),
+          listSkin(0.0f),
+          neighbourGrid(viewPort, 1, 1),
+          isPartitionDirty(true) {}
 
     void AntManager::spawnAnts(const Colony &colony, const float antSize)
     {
@@ -75,6 +94,65 @@ namespace AntColony::Simulation
         {
             ants.emplace_back(shuffledPositions[i], antSize, PHEROMONE_CHARGE_THRESHOLD);
         }
+
+        // Touching ants one step apart and repulsion (COLLISION_COEF sizes) are both within this range
+        listSkin = antSize * NEIGHBOUR_LIST_SKIN;
+        listRadius = 2.0f * antSize + MAX_ANT_STEP + listSkin;
+        neighbourGrid = Core::LooseGrid(
+            viewPort,
+            static_cast<int>(std::ceil((viewPort.maxX - viewPort.minX) / listRadius)),
+            static_cast<int>(std::ceil((viewPort.maxY - viewPort.minY) / listRadius)));
+
+        buildNeighbourLists();
+    }
+
+    void AntManager::sortByMorton(Utils::WorkerPool *pool)
+    {
+        std::vector<std::uint32_t> keys;
+        keys.reserve(ants.size());
+        for (const auto &ant : ants)
+            keys.push_back(Core::mortonKey(ant.getPosition(), viewPort));
+
+        std::vector<std::uint32_t> order;
+        Utils::radixSortOrder(keys, order, pool);
+
+        std::vector<Ant> sorted;
+        sorted.reserve(ants.size());
+        for (const auto index : order)
+            sorted.push_back(std::move(ants[index]));
+        ants.swap(sorted);
+
+        // Lists and partitions hold ant indices
+        buildNeighbourLists();
+        isPartitionDirty = true;
+    }
+
+    void AntManager::buildNeighbourLists()
+    {
+        for (size_t i = 0; i < ants.size(); i++)
+            neighbourGrid.insert(static_cast<std::uint32_t>(i), ants[i].getPosition(), 0.0f);
+
+        listPositions.resize(ants.size());
+        neighbourOffsets.resize(ants.size() + 1);
+        neighbours.clear();
+
+        for (size_t i = 0; i < ants.size(); i++)
+        {
+            const auto position = ants[i].getPosition();
+            listPositions[i] = position;
+            neighbourOffsets[i] = static_cast<std::uint32_t>(neighbours.size());
+
+            neighbourGrid.forEachNear(position, listRadius, [&](std::uint32_t other)
+                                      {
+                                          if (other != i && position.distanceTo(ants[other].getPosition()) < listRadius)
+                                              neighbours.push_back(other);
+                                      });
+
+            // Index order keeps the repulsion sums identical to a scan over all ants
+            std::sort(neighbours.begin() + neighbourOffsets[i], neighbours.end());
+        }
+
+        neighbourOffsets[ants.size()] = static_cast<std::uint32_t>(neighbours.size());
     }
 
     std::vector<Core::Point> AntManager::generateHexGrid(Core::Point center, float radius, float cellSize)
@@ -122,16 +200,13 @@ namespace AntColony::Simulation
         return positions;
     }
 
-    bool AntManager::checkAntCollisions(const Core::Point &newPosition, float antSize, size_t currentIndex, const std::vector<Ant> &ants)
+    bool AntManager::checkAntCollisions(const Core::Point &newPosition, float antSize, size_t currentIndex) const
     {
         auto hasCollision = false;
 
-        for (auto i = 0; i < ants.size(); i++)
+        for (auto n = neighbourOffsets[currentIndex]; n < neighbourOffsets[currentIndex + 1]; n++)
         {
-            if (i == currentIndex)
-                continue;
-
-            const auto &otherAnt = ants[i];
+            const auto &otherAnt = ants[neighbours[n]];
 
             if (checkCollision(newPosition, otherAnt.getPosition(), antSize, otherAnt.getSize()))
             {
@@ -144,21 +219,10 @@ namespace AntColony::Simulation
         return hasCollision;
     }
 
-    std::shared_ptr<Food> AntManager::checkFoodCollisions(const Core::Point &newPosition, float antSize, const std::vector<std::shared_ptr<Food>> &food)
+    FoodHandle AntManager::checkFoodCollisions(const Core::Point &newPosition, float antSize, const FoodManager &foodManager)
     {
-        for (auto piece : food)
-        {
-            if (piece->getCapacity() <= 0)
-                continue;
-
-            if (checkCollision(newPosition, piece->getPosition(), antSize, piece->getSize()))
-            {
-                return piece;
-            }
-        }
-
-        // No collision found
-        return nullptr;
+        // Only visits food near the ant, emptied food waiting for removal is skipped
+        return foodManager.findCollision(newPosition, antSize);
     }
 
     bool AntManager::checkCollision(
@@ -202,13 +266,10 @@ namespace AntColony::Simulation
             random.getFloat(-RANDOM_MOVEMENT, RANDOM_MOVEMENT),
             random.getFloat(-RANDOM_MOVEMENT, RANDOM_MOVEMENT));
 
-        // Calculate repulsion from each other ant
-        for (auto i = 0; i < ants.size(); i++)
+        // Calculate repulsion from each neighbouring ant
+        for (auto n = neighbourOffsets[currentIndex]; n < neighbourOffsets[currentIndex + 1]; n++)
         {
-            if (i == currentIndex)
-                continue;
-
-            const auto &otherAnt = ants[i];
+            const auto &otherAnt = ants[neighbours[n]];
             const auto otherPosition = otherAnt.getPosition();
 
             auto dx = otherPosition.x - currentPosition.x;
@@ -244,47 +305,101 @@ namespace AntColony::Simulation
         return totalRepulsion * REPULSION_SCALING;
     }
 
-    bool AntManager::updateAnt(
-        const Colony &colony,
-        Counter &foodCounter,
-        const std::vector<std::shared_ptr<Food>> &food,
-        const std::vector<PheromoneSignal> &incomingSignals,
-        const float maxPheromoneDetectionDistance,
-        const float maxPheromoneRealtiveStrength,
-        size_t currentIndex)
+    void AntManager::partitionAnts()
     {
-        const auto colonyPosition = colony.getPosition();
-        const auto colonySize = colony.getSize();
+        carryingAnts.clear();
+        exploringAnts.clear();
 
-        auto &ant = ants[currentIndex];
-        const auto currentVelocity = ant.getVelocity();
-        const auto currentPosition = ant.getPosition();
-        const auto antSize = ant.getSize();
+        // Index order, so every kernel walks the ants forwards
+        for (std::uint32_t i = 0; i < ants.size(); i++)
+            (ants[i].isBusy() ? carryingAnts : exploringAnts).push_back(i);
 
-        // If carrying food, move toward colony
-        if (ant.isBusy())
+        isPartitionDirty = false;
+    }
+
+    void AntManager::steerCarryingAnts(const Core::Point &colonyPosition)
+    {
+        for (const auto i : carryingAnts)
+            ants[i].setVelocity(calcVelocityTowards(ants[i].getPosition(), colonyPosition, COLONY_TARGET_ATTRACTION));
+    }
+
+    void AntManager::steerExploringAnts(
+        const std::vector<PheromoneSignal> &incomingSignals,
+        const float maxPheromoneDetectionDistance,
+        const int maxPheromoneRealtiveStrength)
+    {
+        signalX.clear();
+        signalY.clear();
+        signalStrengths.clear();
+        for (const auto &signal : incomingSignals)
         {
-            const auto newVelocity = calcVelocityTowards(currentPosition, colonyPosition, COLONY_TARGET_ATTRACTION);
-            ant.setVelocity(newVelocity);
+            signalX.push_back(signal.position.x);
+            signalY.push_back(signal.position.y);
+            signalStrengths.push_back(static_cast<float>(signal.excitement));
         }
-        else
+
+        for (const auto i : exploringAnts)
         {
+            auto &ant = ants[i];
+            const auto currentPosition = ant.getPosition();
+            const auto currentVelocity = ant.getVelocity();
+
+            // The heading is the same for every pheromone
+            auto headingX = currentVelocity.x;
+            auto headingY = currentVelocity.y;
+            const auto velocityMagnitude = std::sqrt(currentVelocity.x * currentVelocity.x + currentVelocity.y * currentVelocity.y);
+            if (velocityMagnitude > 0)
+            {
+                headingX /= velocityMagnitude;
+                headingY /= velocityMagnitude;
+            }
+
             // Find the most attractive pheromone
             auto bestAttraction = 0.0f;
-            Core::Point bestTarget;
+            Core::Point bestTarget(0.0f, 0.0f);
+
+            // Eight pheromones at a time, lanes are compared in order so ties go to the same pheromone
+            const Core::Vec2x8 antPositions(currentPosition);
+            const Core::Vec2x8 headings(Core::Point(headingX, headingY));
+            float attractions[8];
 
-            for (const auto &signal : incomingSignals)
+            size_t s = 0;
+            for (; s + 8 <= signalX.size(); s += 8)
             {
-                auto attraction = calcPheromoneAttraction(
+                calcPheromoneAttractions(
+                    antPositions,
+                    headings,
+                    Core::Vec2x8::load(&signalX[s], &signalY[s]),
+                    Core::Floatx8::load(&signalStrengths[s]),
+                    maxPheromoneDetectionDistance,
+                    maxPheromoneRealtiveStrength)
+                    .store(attractions);
+
+                for (auto lane = 0; lane < 8; lane++)
+                {
+                    if (attractions[lane] > bestAttraction)
+                    {
+                        bestAttraction = attractions[lane];
+                        bestTarget = Core::Point(signalX[s + lane], signalY[s + lane]);
+                    }
+                }
+            }
+
+            for (; s < signalX.size(); s++)
+            {
+                const auto attraction = calcPheromoneAttraction(
                     currentPosition,
-                    currentVelocity,
-                    signal,
+                    headingX,
+                    headingY,
+                    signalX[s],
+                    signalY[s],
+                    signalStrengths[s],
                     maxPheromoneDetectionDistance,
                     maxPheromoneRealtiveStrength);
                 if (attraction > bestAttraction)
                 {
                     bestAttraction = attraction;
-                    bestTarget = signal.position;
+                    bestTarget = Core::Point(signalX[s], signalY[s]);
                 }
             }
 
@@ -299,24 +414,39 @@ namespace AntColony::Simulation
                 ant.setVelocity(attractionVelocity);
             }
         }
+    }
+
+    bool AntManager::updateAnt(
+        const Colony &colony,
+        Counter &foodCounter,
+        FoodManager &foodManager,
+        size_t currentIndex)
+    {
+        const auto colonyPosition = colony.getPosition();
+        const auto colonySize = colony.getSize();
+
+        auto &ant = ants[currentIndex];
+        const auto currentVelocity = stepVelocities[currentIndex];
+        const auto currentPosition = ant.getPosition();
+        const auto antSize = ant.getSize();
 
         if (ant.isMoving())
         {
             // Try moving with current velocity
             const auto newPosition = currentPosition + currentVelocity;
-            bool validPosition = !checkAntCollisions(newPosition, antSize, currentIndex, ants) && viewPort.checkViewportBoundaries(newPosition);
+            bool validPosition = !checkAntCollisions(newPosition, antSize, currentIndex) && viewPort.checkViewportBoundaries(newPosition);
 
             if (validPosition)
             {
                 // Check for food collision
                 if (!ant.isBusy())
                 {
-                    auto collidedFood = checkFoodCollisions(newPosition, antSize, food);
+                    const auto collidedFood = checkFoodCollisions(newPosition, antSize, foodManager);
 
-                    if (collidedFood)
+                    if (collidedFood.isValid())
                     {
                         // Collect food
-                        ant.biteFood(collidedFood);
+                        ant.biteFood(foodManager.take(collidedFood));
                     }
                 }
 
@@ -340,16 +470,16 @@ namespace AntColony::Simulation
             const auto newPosition = currentPosition + repulsion;
 
             // Check if this position is valid
-            auto validPosition = !checkAntCollisions(newPosition, antSize, currentIndex, ants) && viewPort.checkViewportBoundaries(newPosition);
+            auto validPosition = !checkAntCollisions(newPosition, antSize, currentIndex) && viewPort.checkViewportBoundaries(newPosition);
 
             if (validPosition)
             {
                 // Check for food interactions
-                auto collidedFood = checkFoodCollisions(newPosition, antSize, food);
-                if (collidedFood && !ant.isBusy())
+                const auto collidedFood = checkFoodCollisions(newPosition, antSize, foodManager);
+                if (collidedFood.isValid() && !ant.isBusy())
                 {
                     // Collect food
-                    ant.biteFood(collidedFood);
+                    ant.biteFood(foodManager.take(collidedFood));
                 }
                 else
                 {
@@ -384,91 +514,177 @@ namespace AntColony::Simulation
     std::stack<PheromoneSignal> AntManager::update(
         const Colony &colony,
         Counter &foodCounter,
-        const std::vector<std::shared_ptr<Food>> &food,
-        const std::vector<PheromoneSignal> &incomingSignals)
+        FoodManager &foodManager,
+        const std::vector<PheromoneSignal> &incomingSignals,
+        int maxPheromoneStrength)
     {
         std::stack<PheromoneSignal> outcomingSignals;
 
         // Assume it is half of the minimal viewport distance
         const auto maxPheromonAffectDistance = std::min(viewPort.maxX - viewPort.minX, viewPort.maxY - viewPort.minY);
 
-        // Get the maximum strength
-        const auto strongestPheromone = std::max_element(
-            incomingSignals.begin(),
-            incomingSignals.end(),
-            [](const PheromoneSignal &a, const PheromoneSignal &b)
-            {
-                return a.excitement < b.excitement;
-            });
+        if (neighbourOffsets.size() != ants.size() + 1)
+            buildNeighbourLists();
+
+        if (isPartitionDirty || carryingAnts.size() + exploringAnts.size() != ants.size())
+            partitionAnts();
+
+        // Ants move by the velocity they had before steering, the new one takes effect on the next tick
+        stepVelocities.resize(ants.size());
+        for (size_t i = 0; i < ants.size(); i++)
+            stepVelocities[i] = ants[i].getVelocity();
 
-        const auto maxPheromoneRealtiveStrength = strongestPheromone == incomingSignals.end()
-                                                      ? 0
-                                                      : strongestPheromone->excitement;
+        // Steering only reads the ant itself and the pheromones, so each state runs as its own batch
+        steerCarryingAnts(colony.getPosition());
+        steerExploringAnts(incomingSignals, maxPheromonAffectDistance, maxPheromoneStrength);
 
+        // Movement stays in index order, ants collide with the places the previous ones just moved to
         for (auto i = 0; i < ants.size(); i++)
         {
-            if (updateAnt(colony, foodCounter, food, incomingSignals, maxPheromonAffectDistance, maxPheromoneRealtiveStrength, i))
+            const auto wasBusy = ants[i].isBusy();
+
+            if (updateAnt(colony, foodCounter, foodManager, i))
             {
                 const auto signal = ants[i].consumePheromoneCharge();
                 outcomingSignals.push(signal);
             }
+
+            if (ants[i].isBusy() != wasBusy)
+                isPartitionDirty = true;
+
+            // Lists stay complete while no ant is more than half the skin away from where they were built
+            if (ants[i].getPosition().distanceTo(listPositions[i]) > listSkin * 0.5f)
+                buildNeighbourLists();
         }
 
         return outcomingSignals;
     }
 
-    void AntManager::render(Render::Renderer &renderer)
+    void AntManager::render(Render::Renderer &renderer, const Render::Camera &camera)
     {
+        const auto visibleArea = camera.getVisibleArea();
+        const auto cellArea = static_cast<float>(SPLAT_CELL_PIXELS * SPLAT_CELL_PIXELS);
+
+        for (auto &layer : splatLayers)
+            layer.isUsed = false;
+
         for (auto &ant : ants)
-            ant.render(renderer);
+        {
+            if (!visibleArea.overlapsCircle(ant.getPosition(), ant.getSize()))
+                continue;
+
+            const auto pixelRadius = camera.worldToPixels(ant.getSize());
+            if (pixelRadius >= LOD_PIXEL_RADIUS)
+            {
+                ant.render(renderer);
+                continue;
+            }
+
+            // Fraction of the cell the ant covers, overlapping ants saturate at full opacity
+            getSplatGrid(ant.getColor(), camera).accumulate(ant.getPosition(), static_cast<float>(M_PI) * pixelRadius * pixelRadius / cellArea);
+        }
+
+        for (auto &layer : splatLayers)
+        {
+            if (!layer.isUsed)
+                continue;
+
+            layer.grid.maxValue = 1.0f;
+            renderer.drawCoverageGrid(layer.grid, Core::Color(layer.color));
+        }
+    }
+
+    Core::DensityGrid &AntManager::getSplatGrid(unsigned int color, const Render::Camera &camera)
+    {
+        // Ants come in a handful of colors, a linear search beats hashing
+        auto layer = std::find_if(splatLayers.begin(), splatLayers.end(), [color](const SplatLayer &layer)
+                                  { return layer.color == color; });
+        if (layer == splatLayers.end())
+            layer = splatLayers.insert(splatLayers.end(), {color, Core::DensityGrid(viewPort, 0, 0), false});
+
+        auto &splatGrid = layer->grid;
+        if (layer->isUsed)
+            return splatGrid;
+        layer->isUsed = true;
+
+        const auto width = std::max(1, (camera.getViewportWidth() + SPLAT_CELL_PIXELS - 1) / SPLAT_CELL_PIXELS);
+        const auto height = std::max(1, (camera.getViewportHeight() + SPLAT_CELL_PIXELS - 1) / SPLAT_CELL_PIXELS);
+
+        if (width != splatGrid.width || height != splatGrid.height)
+        {
+            logger->debug("Ant splat grid resized to " + std::to_string(width) + "x" + std::to_string(height));
+            splatGrid = Core::DensityGrid(camera.getVisibleArea(), width, height);
+            return splatGrid;
+        }
+
+        splatGrid.area = camera.getVisibleArea();
+        splatGrid.clear();
+        return splatGrid;
     }
 
     float AntManager::calcPheromoneAttraction(
         const Core::Point &antPosition,
-        const Core::Point &antVelocity,
-        const PheromoneSignal &pheromone,
+        const float headingX,
+        const float headingY,
+        const float pheromoneX,
+        const float pheromoneY,
+        const float pheromoneStrength,
         const float maxDetectionDistance,
         const int maxRealtiveStrength)
     {
         // Calculate vector to pheromone
-        Core::Point directionToPheromone = pheromone.position - antPosition;
-        auto distance = antPosition.distanceTo(pheromone.position);
+        const auto dx = pheromoneX - antPosition.x;
+        const auto dy = pheromoneY - antPosition.y;
+        const auto distance = std::sqrt(dx * dx + dy * dy);
 
-        if (distance > maxDetectionDistance)
-            return 0.0f;
+        // Selects instead of early returns keep the loop over pheromones free of branches
 
         // 1. Direction component - how aligned is ant's movement with pheromone direction?
-        Core::Point normalizedDirection = directionToPheromone;
-        if (distance > 0)
-        {
-            normalizedDirection.x /= distance;
-            normalizedDirection.y /= distance;
-        }
-
-        Core::Point normalizedVelocity = antVelocity;
-        auto velocityMagnitude = std::sqrt(antVelocity.x * antVelocity.x + antVelocity.y * antVelocity.y);
-        if (velocityMagnitude > 0)
-        {
-            normalizedVelocity.x /= velocityMagnitude;
-            normalizedVelocity.y /= velocityMagnitude;
-        }
+        const auto directionX = distance > 0 ? dx / distance : dx;
+        const auto directionY = distance > 0 ? dy / distance : dy;
 
         // Dot product: 1 if same direction, -1 if opposite
-        auto directionAlignment = normalizedDirection.x * normalizedVelocity.x +
-                                  normalizedDirection.y * normalizedVelocity.y;
+        const auto directionAlignment = directionX * headingX + directionY * headingY;
 
         // Remap from [-1, 1] to [0.5, 1.5]
-        auto directionComponent = 1.0f + (directionAlignment * 0.5f);
+        const auto directionComponent = 1.0f + (directionAlignment * 0.5f);
 
         // 2. Distance component - closer pheromones are more attractive
-        auto distanceComponent = 1.0f - (distance / maxDetectionDistance);
+        const auto distanceComponent = 1.0f - (distance / maxDetectionDistance);
 
         // 3. Strength component - stronger pheromones are more attractive
-        auto relativeStrength = static_cast<float>(pheromone.excitement) / maxRealtiveStrength;
-        auto strengthComponent = std::min(0.5f, relativeStrength);
+        const auto relativeStrength = pheromoneStrength / maxRealtiveStrength;
+        const auto strengthComponent = std::min(0.5f, relativeStrength);
+
+        // Combine components and ensure result is in [0, 2], pheromones out of range do not attract
+        const auto attraction = directionComponent * distanceComponent * strengthComponent * 2.0f;
+        return distance > maxDetectionDistance ? 0.0f : std::min(2.0f, std::max(0.0f, attraction));
+    }
+
+    Core::Floatx8 AntManager::calcPheromoneAttractions(
+        const Core::Vec2x8 &antPositions,
+        const Core::Vec2x8 &headings,
+        const Core::Vec2x8 &pheromonePositions,
+        const Core::Floatx8 &pheromoneStrengths,
+        const float maxDetectionDistance,
+        const int maxRealtiveStrength)
+    {
+        // Same operations in the same order as calcPheromoneAttraction, lanes round exactly like it
+        const auto zero = Core::Floatx8(0.0f);
+        const auto maxDistance = Core::Floatx8(maxDetectionDistance);
+
+        const auto toPheromones = pheromonePositions - antPositions;
+        const auto distances = toPheromones.length();
+
+        const Core::Vec2x8 directions(
+            selectGreater(distances, zero, toPheromones.x / distances, toPheromones.x),
+            selectGreater(distances, zero, toPheromones.y / distances, toPheromones.y));
+
+        const auto directionComponents = Core::Floatx8(1.0f) + directions.dot(headings) * Core::Floatx8(0.5f);
+        const auto distanceComponents = Core::Floatx8(1.0f) - distances / maxDistance;
+        const auto strengthComponents = min(Core::Floatx8(0.5f), pheromoneStrengths / Core::Floatx8(static_cast<float>(maxRealtiveStrength)));
 
-        // Combine components and ensure result is in [0, 2]
-        auto attraction = directionComponent * distanceComponent * strengthComponent * 2.0f;
-        return std::min(2.0f, std::max(0.0f, attraction));
+        const auto attractions = directionComponents * distanceComponents * strengthComponents * Core::Floatx8(2.0f);
+        return selectGreater(distances, maxDistance, zero, min(Core::Floatx8(2.0f), max(zero, attractions)));
     }
 }
\ No newline at end of file
@@ -3,13 +3,20 @@
 #include "ant.hpp"
 #include "colony.hpp"
 #include "food.hpp"
+#include "foodManager.hpp"
 #include "baseEntityManager.hpp"
 #include "pheromoneSignal.hpp"
 #include "counter.hpp"
 
 #include "../core/logger.hpp"
 #include "../core/viewPort.hpp"
+#include "../core/densityGrid.hpp"
+#include "../core/looseGrid.hpp"
+#include "../core/vec2Batch.hpp"
+#include "../render/_fwd.hpp"
+#include "../utils/_fwd.hpp"
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <stack>
@@ -47,20 +54,33 @@ namespace AntColony::Simulation
         /**
          * @brief Updates all ants' positions and states
          * @param colony The colony that ants interact with
-         * @param food Vector of food sources that ants can interact with
+         * @param foodManager Food that ants can interact with, emptied food stays until its next update
+         * @param incomingSignals Live pheromones
+         * @param maxPheromoneStrength Strength of the strongest incoming signal, maintained by PheromoneManager
          * @return Stack of signals representing positions where pheromone should spawn and its relative strength (ants excitement)
          */
         std::stack<PheromoneSignal> update(
             const Colony &colony,
             Counter &foodCounter,
-            const std::vector<std::shared_ptr<Food>> &food,
-            const std::vector<PheromoneSignal> &incomingSignals);
+            FoodManager &foodManager,
+            const std::vector<PheromoneSignal> &incomingSignals,
+            int maxPheromoneStrength);
 
         /**
-         * @brief Renders all ants to the window
+         * @brief Renders the ants overlapping the visible area
+         *
+         * Ants smaller than about a pixel on screen are splatted into a coverage grid drawn
+         * in one call instead of being drawn one by one.
          * @param renderer The renderer to be used
+         * @param camera Maps the world to the screen, ants outside its visible area are culled
          */
-        void render(Render::Renderer &renderer);
+        void render(Render::Renderer &renderer, const Render::Camera &camera);
+
+        /**
+         * @brief Reorders the ants by Morton key of their position, so ants near in space are near in memory
+         * @param pool Threads for the sort, null sorts on the calling thread
+         */
+        void sortByMorton(Utils::WorkerPool *pool);
 
     private:
         /**
@@ -73,6 +93,86 @@ namespace AntColony::Simulation
          */
         Core::ViewPort viewPort;
 
+        /**
+         * @brief Coverage of the ants of one color below the level of detail threshold
+         */
+        struct SplatLayer
+        {
+            unsigned int color;
+            Core::DensityGrid grid;
+            /// @brief Whether an ant was splatted into the grid this frame.
+            bool isUsed;
+        };
+
+        /**
+         * @brief Splat layers by ant color, reused between frames
+         */
+        std::vector<SplatLayer> splatLayers;
+
+        /**
+         * @brief Verlet neighbour lists, the ants of ant i are neighbours[neighbourOffsets[i]..neighbourOffsets[i + 1]) in index order
+         *
+         * A list holds every ant within the interaction range plus a skin at the time it was built, so it stays
+         * complete until some ant has moved half the skin away from its position at that time.
+         */
+        std::vector<std::uint32_t> neighbourOffsets;
+        std::vector<std::uint32_t> neighbours;
+        /// @brief Ant positions when the lists were built.
+        std::vector<Core::Point> listPositions;
+        /// @brief Interaction range plus skin.
+        float listRadius;
+        /// @brief Margin of the lists beyond the interaction range.
+        float listSkin;
+        /// @brief Bins ant centers to build the lists without comparing every pair.
+        Core::LooseGrid neighbourGrid;
+
+        /**
+         * @brief Rebuilds the neighbour lists from the current ant positions
+         */
+        void buildNeighbourLists();
+
+        /**
+         * @brief Indices of the ants carrying food and of the exploring ones, in index order
+         *
+         * Rebuilt at the start of a tick after an ant picked up or dropped food, or after a reorder.
+         */
+        std::vector<std::uint32_t> carryingAnts;
+        std::vector<std::uint32_t> exploringAnts;
+        bool isPartitionDirty;
+
+        /// @brief Velocity of each ant before steering, the ant moves by it this tick.
+        std::vector<Core::Point> stepVelocities;
+
+        /// @brief Incoming pheromones as coordinate and strength arrays, reused between ticks.
+        std::vector<float> signalX;
+        std::vector<float> signalY;
+        std::vector<float> signalStrengths;
+
+        /**
+         * @brief Sorts the ant indices into the carrying and exploring partitions
+         */
+        void partitionAnts();
+
+        /**
+         * @brief Points every carrying ant at the colony
+         */
+        void steerCarryingAnts(const Core::Point &colonyPosition);
+
+        /**
+         * @brief Turns every exploring ant towards its most attractive pheromone, if any is attractive enough
+         */
+        void steerExploringAnts(
+            const std::vector<PheromoneSignal> &incomingSignals,
+            const float maxPheromoneDetectionDistance,
+            const int maxPheromoneRealtiveStrength);
+
+        /**
+         * @brief Splat grid of a color, cleared and fitted to the visible area at the current viewport size on first use in a frame
+         * @param color Color of the splatted ant
+         * @param camera Camera the frame is drawn with
+         */
+        Core::DensityGrid &getSplatGrid(unsigned int color, const Render::Camera &camera);
+
         /**
          * @brief Generates a grid of hexagonal cells inside a circle
          * @param center Center point of the circle
@@ -83,23 +183,22 @@ namespace AntColony::Simulation
         static std::vector<Core::Point> generateHexGrid(Core::Point center, float radius, float cellSize);
 
         /**
-         * @brief Checks if a position will collide with any other ant
-         * @param newPosition Position to check for collisions
+         * @brief Checks if a position will collide with any neighbour of an ant
+         * @param newPosition Position to check for collisions, at most one step away from the ant
          * @param antSize Size of the ant
-         * @param currentIndex Index of the current ant (to avoid self-collision)
-         * @param ants Vector of ants to check against
+         * @param currentIndex Index of the current ant, its neighbour list is checked
          * @return True if collision detected, false otherwise
          */
-        static bool checkAntCollisions(const Core::Point &newPosition, float antSize, size_t currentIndex, const std::vector<Ant> &ants);
+        bool checkAntCollisions(const Core::Point &newPosition, float antSize, size_t currentIndex) const;
 
         /**
          * @brief Checks if a position collides with food and returns the first food encountered
          * @param newPosition Position to check for collisions
          * @param antSize Size of the ant
-         * @param food Vector of food sources to check against
-         * @return Pointer to collided food or nullptr if no collision
+         * @param foodManager Food to check against
+         * @return Handle of the collided food or an invalid handle if no collision
          */
-        static std::shared_ptr<Food> checkFoodCollisions(const Core::Point &newPosition, float antSize, const std::vector<std::shared_ptr<Food>> &food);
+        static FoodHandle checkFoodCollisions(const Core::Point &newPosition, float antSize, const FoodManager &foodManager);
 
         /**
          * @brief Calculates velocity vector towards a target
@@ -119,19 +218,15 @@ namespace AntColony::Simulation
         Core::Point calcRepulsion(const Ant &ant, size_t currentIndex) const;
 
         /**
-         * @brief                   Updates a single ant's position and state
+         * @brief                   Moves a single steered ant and updates its state
          * @param colony            The colony that ants interact with
-         * @param food              Vector of food sources
-         * @param incomingSignals   Vector of pheromones
+         * @param foodManager       Food sources
          * @param currentIndex      Index of the ant to update
          * @return                  True if pheromone should be spawn
          */
         bool updateAnt(const Colony &colony,
                        Counter &foodCounter,
-                       const std::vector<std::shared_ptr<Food>> &food,
-                       const std::vector<PheromoneSignal> &incomingSignals,
-                       const float maxPheromoneDetectionDistance,
-                       const float maxPheromoneRealtiveStrength,
+                       FoodManager &foodManager,
                        size_t currentIndex);
 
         /**
@@ -148,10 +243,28 @@ namespace AntColony::Simulation
             const float &lSize,
             const float &rSize);
 
+        /**
+         * @brief Attraction of a pheromone in [0, 2], from alignment with the heading, distance and relative strength
+         * @param headingX, headingY Normalised ant velocity, zero for a standing ant
+         */
         static float calcPheromoneAttraction(
             const Core::Point &antPosition,
-            const Core::Point &antVelocity,
-            const PheromoneSignal &pheromone,
+            const float headingX,
+            const float headingY,
+            const float pheromoneX,
+            const float pheromoneY,
+            const float pheromoneStrength,
+            const float maxDetectionDistance,
+            const int maxRealtiveStrength);
+
+        /**
+         * @brief calcPheromoneAttraction for eight pheromones at once, with identical results per lane
+         */
+        static Core::Floatx8 calcPheromoneAttractions(
+            const Core::Vec2x8 &antPositions,
+            const Core::Vec2x8 &headings,
+            const Core::Vec2x8 &pheromonePositions,
+            const Core::Floatx8 &pheromoneStrengths,
             const float maxDetectionDistance,
             const int maxRealtiveStrength);
 
@@ -5,16 +5,16 @@
 
 namespace AntColony::Simulation
 {
-    Food::Food(Core::Point position, float size, int capacity, std::function<void(Food*)> onEmpty)
-        : BaseEntity(position, 0x387d27, size), capacity(capacity), onEmpty(onEmpty) {}
+    Food::Food(Core::Point position, float size, int capacity)
+        : BaseEntity(position, 0x387d27, size), capacity(capacity) {}
 
-    void Food::take()
+    bool Food::take()
     {
-        if (capacity > 0)
-            capacity -= 1;
+        if (capacity <= 0)
+            return false;
 
-        if (capacity <= 0 && onEmpty)
-            onEmpty(this);
+        capacity -= 1;
+        return capacity == 0;
     }
 
     void Food::render(Render::Renderer &renderer)
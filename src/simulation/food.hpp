@@ -5,16 +5,21 @@
 
 #include "../core/point.hpp"
 
-#include <functional>
-
 namespace AntColony::Simulation
 {
+    /// @brief Most portions a food spot is created with.
+    constexpr auto MAX_FOOD_CAPACITY = 3;
+
     class Food : public Entity, public BaseEntity
     {
     public:
-        Food(Core::Point position, float size, int capacity, std::function<void(Food*)> onEmpty);
+        Food(Core::Point position, float size, int capacity);
 
-        void take();
+        /**
+         * @brief Takes one portion
+         * @return True if this emptied the food spot
+         */
+        bool take();
         void render(Render::Renderer &renderer) override;
 
         int getCapacity() const;
@@ -23,10 +28,5 @@ namespace AntColony::Simulation
 
     private:
         int capacity;
-
-        /**
-         * @brief Is called when food spot is empty
-         */
-        std::function<void(Food*)> onEmpty;
     };
 }
\ No newline at end of file
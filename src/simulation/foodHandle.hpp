@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace AntColony::Simulation
+{
+    /**
+     * @brief Stable reference to a food piece in FoodManager.
+     *
+     * The slot outlives the piece, its generation is bumped on removal so a handle to removed food
+     * no longer resolves even after the slot is reused.
+     */
+    struct FoodHandle
+    {
+        static constexpr const std::uint32_t INVALID_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t slot = INVALID_SLOT;
+        std::uint32_t generation = 0;
+
+        bool isValid() const { return slot != INVALID_SLOT; }
+    };
+}
@@ -8,8 +8,39 @@
 
 namespace AntColony::Simulation
 {
+    // Chance per tick to spawn new food (0.4%)
+    constexpr auto FOOD_SPAWN_CHANCE = 1.0f / 250.0f;
+    // Ticks covered by one revolution of the event wheel, a few times the mean spawn wait
+    constexpr auto EVENT_WHEEL_SIZE = 1024;
+    // Random tries to find the first free place when seeding
+    constexpr auto POISSON_SEED_ATTEMPTS = 100;
+    // Candidates tried around an active sample before it is retired, Bridson's k
+    constexpr auto POISSON_CANDIDATES = 30;
+
+    namespace
+    {
+        // Grid cells about the size of the largest food, so a query visits a few cells around the ant
+        Core::LooseGrid createFoodGrid(const Core::ViewPort &viewPort, float foodRadius)
+        {
+            const auto cellSize = foodRadius * MAX_FOOD_CAPACITY;
+            return Core::LooseGrid(
+                viewPort,
+                static_cast<int>(std::ceil((viewPort.maxX - viewPort.minX) / cellSize)),
+                static_cast<int>(std::ceil((viewPort.maxY - viewPort.minY) / cellSize)));
+        }
+    }
+
     FoodManager::FoodManager(std::shared_ptr<Core::Logger> logger, Core::Point colonyCenter, float colonyRadius, float foodRadius, Core::ViewPort viewPort)
-        : BaseEntityManager(logger), colonyCenter(colonyCenter), colonyRadius(colonyRadius), foodRadius(foodRadius), viewPort(viewPort) {}
+        : BaseEntityManager(logger),
+          colonyCenter(colonyCenter),
+          colonyRadius(colonyRadius),
+          foodRadius(foodRadius),
+          viewPort(viewPort),
+          grid(createFoodGrid(viewPort, foodRadius)),
+          events(EVENT_WHEEL_SIZE)
+    {
+        scheduleSpawn();
+    }
 
     FoodManager::FoodManager(Core::Point colonyCenter, float colonyRadius, float foodRadius, Core::ViewPort viewPort)
         : FoodManager(std::make_shared<Utils::ConsoleLogger>(), colonyCenter, colonyRadius, foodRadius, viewPort) {}
@@ -28,7 +59,7 @@ namespace AntColony::Simulation
         debug(startTime, "Spawn new food");
 
         auto &random = AntColony::Utils::RandomGenerator::getInstance();
-        const auto maxCapacity = random.getInt(1, 3);
+        const auto maxCapacity = random.getInt(1, MAX_FOOD_CAPACITY);
 
         // Pre-calculate viewport distances from colony
         const float initialFoodSize = foodRadius * maxCapacity;
@@ -75,45 +106,248 @@ namespace AntColony::Simulation
         float x = colonyCenter.x + distance * dx;
         float y = colonyCenter.y + distance * dy;
 
-        auto food = std::make_unique<Food>(
-            Core::Point(x, y),
-            foodRadius,
-            maxCapacity,
-            [this](Food *f)
-            { this->foodParticles.erase(f); });
+        addFood(Core::Point(x, y), maxCapacity);
+    }
+
+    void FoodManager::addFood(const Core::Point &position, int capacity)
+    {
+        // Reuse a free slot, its generation already differs from the handles of the removed food
+        std::uint32_t slot;
+        if (freeSlots.empty())
+        {
+            slot = static_cast<std::uint32_t>(slots.size());
+            slots.push_back({0, 0});
+        }
+        else
+        {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
 
-        // Store in map with pointer as key
-        foodParticles[food.get()] = std::move(food);
+        slots[slot].index = static_cast<std::uint32_t>(foodParticles.size());
+        foodParticles.emplace_back(position, foodRadius, capacity);
+        particleSlots.push_back(slot);
+        grid.insert(slot, foodParticles.back().getPosition(), foodParticles.back().getSize());
     }
 
-    void FoodManager::update()
+    std::size_t FoodManager::seedFood(std::size_t count)
     {
         auto &random = AntColony::Utils::RandomGenerator::getInstance();
 
-        // Random chance per cycle to spawn new food (0.4% chance)
-        if (random.getInt(0, 249) == 0)
-            spawnFood();
+        // Food of any capacity is apart at this distance, it also keeps the largest food inside the viewport
+        const auto maxFoodSize = foodRadius * MAX_FOOD_CAPACITY;
+        const auto minDistance = 2.0f * maxFoodSize;
+        const Core::ViewPort area(viewPort.minX + maxFoodSize, viewPort.minY + maxFoodSize, viewPort.maxX - maxFoodSize, viewPort.maxY - maxFoodSize);
+        const auto minColonyDistance = colonyRadius + maxFoodSize;
+
+        // Background grid holding at most one sample per cell
+        const auto cellSize = minDistance / std::sqrt(2.0f);
+        const auto width = std::max(1, static_cast<int>(std::ceil((area.maxX - area.minX) / cellSize)));
+        const auto height = std::max(1, static_cast<int>(std::ceil((area.maxY - area.minY) / cellSize)));
+        std::vector<int> background(static_cast<size_t>(width) * height, -1);
+
+        std::vector<Core::Point> samples;
+        std::vector<int> active;
+
+        const auto cellX = [&](float x)
+        { return std::clamp(static_cast<int>((x - area.minX) / cellSize), 0, width - 1); };
+        const auto cellY = [&](float y)
+        { return std::clamp(static_cast<int>((y - area.minY) / cellSize), 0, height - 1); };
+
+        const auto isFree = [&](const Core::Point &position)
+        {
+            if (!area.checkViewportBoundaries(position) || position.distanceTo(colonyCenter) < minColonyDistance)
+                return false;
+
+            // Samples closer than minDistance can only be in the 5x5 cells around
+            const auto x = cellX(position.x);
+            const auto y = cellY(position.y);
+            for (auto ny = std::max(0, y - 2); ny <= std::min(height - 1, y + 2); ny++)
+            {
+                for (auto nx = std::max(0, x - 2); nx <= std::min(width - 1, x + 2); nx++)
+                {
+                    const auto sample = background[ny * width + nx];
+                    if (sample >= 0 && position.distanceTo(samples[sample]) < minDistance)
+                        return false;
+                }
+            }
+
+            // Food already in the world
+            auto overlaps = false;
+            grid.forEachNear(position, maxFoodSize, [&](std::uint32_t slot)
+                             {
+                                 const auto &food = foodParticles[slots[slot].index];
+                                 overlaps = overlaps || position.distanceTo(food.getPosition()) < maxFoodSize + food.getSize();
+                             });
+            return !overlaps;
+        };
+
+        const auto addSample = [&](const Core::Point &position)
+        {
+            background[cellY(position.y) * width + cellX(position.x)] = static_cast<int>(samples.size());
+            active.push_back(static_cast<int>(samples.size()));
+            samples.push_back(position);
+        };
+
+        for (auto attempt = 0; attempt < POISSON_SEED_ATTEMPTS && samples.empty(); attempt++)
+        {
+            const Core::Point position(random.getFloat(area.minX, area.maxX), random.getFloat(area.minY, area.maxY));
+            if (isFree(position))
+                addSample(position);
+        }
+
+        // Bridson: grow from random active samples until no candidate fits around any of them
+        while (!active.empty())
+        {
+            const auto activeIndex = random.getInt(0, static_cast<int>(active.size()) - 1);
+            const auto origin = samples[active[activeIndex]];
+
+            auto isPlaced = false;
+            for (auto attempt = 0; attempt < POISSON_CANDIDATES && !isPlaced; attempt++)
+            {
+                // Uniform by area in the annulus [minDistance, 2 * minDistance]
+                const auto angle = random.getFloat(0, 2 * M_PI);
+                const auto distance = std::sqrt(random.getFloat(minDistance * minDistance, 4 * minDistance * minDistance));
+                const auto candidate = origin + Core::Point(std::cos(angle), std::sin(angle)) * distance;
+
+                if (isFree(candidate))
+                {
+                    addSample(candidate);
+                    isPlaced = true;
+                }
+            }
+
+            if (!isPlaced)
+            {
+                active[activeIndex] = active.back();
+                active.pop_back();
+            }
+        }
+
+        // The set covers the whole area, a random subset keeps the density uniform when fewer are requested
+        const auto placed = std::min(count, samples.size());
+        for (std::size_t i = 0; i < placed; i++)
+        {
+            std::swap(samples[i], samples[random.getInt(static_cast<int>(i), static_cast<int>(samples.size()) - 1)]);
+            addFood(samples[i], random.getInt(1, MAX_FOOD_CAPACITY));
+        }
+
+        logger->info("Seeded " + std::to_string(placed) + " food patches out of " + std::to_string(samples.size()) + " free places");
+        return placed;
+    }
+
+    FoodHandle FoodManager::getHandle(std::size_t index) const
+    {
+        const auto slot = particleSlots[index];
+        return {slot, slots[slot].generation};
+    }
+
+    const Food *FoodManager::tryGet(FoodHandle handle) const
+    {
+        if (!handle.isValid() || handle.slot >= slots.size() || slots[handle.slot].generation != handle.generation)
+            return nullptr;
+
+        return &foodParticles[slots[handle.slot].index];
+    }
+
+    FoodHandle FoodManager::findCollision(const Core::Point &position, float radius) const
+    {
+        // Grid order is arbitrary, keep the food a scan of the dense array would find first
+        auto firstIndex = foodParticles.size();
+        grid.forEachNear(position, radius, [&](std::uint32_t slot)
+                         {
+                             const auto index = slots[slot].index;
+                             const auto &food = foodParticles[index];
+                             if (index < firstIndex && food.getCapacity() > 0 && position.distanceTo(food.getPosition()) < radius + food.getSize())
+                                 firstIndex = index;
+                         });
+
+        return firstIndex == foodParticles.size() ? FoodHandle() : getHandle(firstIndex);
+    }
+
+    const Food &FoodManager::take(FoodHandle handle)
+    {
+        auto &food = foodParticles[slots[handle.slot].index];
+        if (food.take())
+            depleted.push_back(handle);
+
+        return food;
     }
 
-    void FoodManager::render(Render::Renderer &renderer) const
+    void FoodManager::remove(FoodHandle handle)
     {
-        for (const auto &[ptr, food] : foodParticles)
+        if (!tryGet(handle))
+            return;
+
+        const auto index = slots[handle.slot].index;
+        const auto last = foodParticles.size() - 1;
+
+        if (index != last)
         {
-            ptr->render(renderer);
+            foodParticles[index] = std::move(foodParticles[last]);
+            particleSlots[index] = particleSlots[last];
+            slots[particleSlots[index]].index = index;
         }
+
+        foodParticles.pop_back();
+        particleSlots.pop_back();
+        grid.remove(handle.slot);
+
+        slots[handle.slot].generation++;
+        freeSlots.push_back(handle.slot);
+    }
+
+    void FoodManager::removeDepleted()
+    {
+        for (const auto handle : depleted)
+            remove(handle);
+
+        depleted.clear();
+    }
+
+    void FoodManager::scheduleSpawn()
+    {
+        auto &random = AntColony::Utils::RandomGenerator::getInstance();
+        events.schedule(events.getNow() + random.getGeometric(FOOD_SPAWN_CHANCE), SPAWN_FOOD);
     }
 
-    std::vector<std::shared_ptr<Food>> FoodManager::getFoodParticles() const
+    void FoodManager::update()
     {
-        std::vector<std::shared_ptr<Food>> result;
-        result.reserve(foodParticles.size());
+        removeDepleted();
+
+        // Only ticks with a due event do any work
+        dueEvents.clear();
+        events.advance(events.getNow() + 1, dueEvents);
 
-        for (const auto &[ptr, food] : foodParticles)
+        for (const auto event : dueEvents)
         {
-            result.emplace_back(food);
+            switch (event)
+            {
+            case SPAWN_FOOD:
+                spawnFood();
+                scheduleSpawn();
+                break;
+            }
         }
+    }
+
+    void FoodManager::render(Render::Renderer &renderer, const Core::ViewPort &visibleArea)
+    {
+        visibleFood.clear();
+        grid.forEachInArea(visibleArea, [&](std::uint32_t slot)
+                           {
+                               const auto index = slots[slot].index;
+                               const auto &food = foodParticles[index];
+                               if (visibleArea.overlapsCircle(food.getPosition(), food.getSize()))
+                                   visibleFood.push_back(index);
+                           });
 
-        return result;
+        // Grid order is arbitrary, draw in dense array order so overlapping food stacks as before
+        std::sort(visibleFood.begin(), visibleFood.end());
+        for (const auto index : visibleFood)
+            foodParticles[index].render(renderer);
     }
 
+    const std::vector<Food> &FoodManager::getFoodParticles() const { return foodParticles; }
+
 }
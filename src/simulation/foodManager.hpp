@@ -2,34 +2,129 @@
 
 #include "baseEntityManager.hpp"
 #include "food.hpp"
+#include "foodHandle.hpp"
 #include "../core/logger.hpp"
 #include "../core/viewPort.hpp"
+#include "../core/looseGrid.hpp"
+#include "../utils/timingWheel.hpp"
 
+#include <cstdint>
 #include <vector>
 #include <memory>
-#include <unordered_map>
 
 namespace AntColony::Simulation
 {
+    /**
+     * @brief Owns the food pieces in a dense array addressed by generational handles.
+     *
+     * Taking the last portion only queues the piece for removal, so the array and handles stay stable
+     * while ants are updated; depleted food is removed at the start of the next update.
+     */
     class FoodManager : public BaseEntityManager
     {
     public:
         FoodManager(std::shared_ptr<Core::Logger> logger, Core::Point colonyCenter, float colonyRadius, float foodRadius, Core::ViewPort viewPort);
         FoodManager(Core::Point colonyCenter, float colonyRadius, float foodRadius, Core::ViewPort viewPort);
 
+        /**
+         * @brief Removes the food depleted since the last update and spawns new food when it is scheduled
+         */
         void update();
-        void render(Render::Renderer &renderer) const;
 
-        std::vector<std::shared_ptr<Food>> getFoodParticles() const;
+        /**
+         * @brief Places many non-overlapping food patches at once with Poisson-disk sampling
+         *
+         * Bridson sampling over the viewport, minus the colony, generates every free place in linear time;
+         * a random subset of them is used, so the food stays uniform by area like spawned food.
+         * @param count Number of patches to place
+         * @return Number of patches placed, fewer when the world is full
+         */
+        std::size_t seedFood(std::size_t count);
+
+        /**
+         * @brief Renders the food overlapping the visible area, only grid cells around the area are visited
+         */
+        void render(Render::Renderer &renderer, const Core::ViewPort &visibleArea);
+
+        /**
+         * @brief Dense array of the food pieces, indices are only stable until the next update
+         */
+        const std::vector<Food> &getFoodParticles() const;
+
+        /**
+         * @brief Handle of the food at an index of getFoodParticles
+         */
+        FoodHandle getHandle(std::size_t index) const;
+
+        /**
+         * @brief Resolves a handle
+         * @return The food, or nullptr if it was removed
+         */
+        const Food *tryGet(FoodHandle handle) const;
+
+        /**
+         * @brief Finds food with portions left that overlaps a circle
+         * @param position Center of the circle
+         * @param radius Radius of the circle
+         * @return Handle of the first overlapping food in getFoodParticles order, or an invalid handle
+         */
+        FoodHandle findCollision(const Core::Point &position, float radius) const;
+
+        /**
+         * @brief Takes one portion of the food, an emptied piece is queued for removal
+         * @param handle Handle of existing food, see tryGet
+         * @return The food after the portion was taken
+         */
+        const Food &take(FoodHandle handle);
+
+        /**
+         * @brief Removes the food queued by take, handles to it no longer resolve
+         */
+        void removeDepleted();
 
     private:
+        enum FOOD_EVENT
+        {
+            SPAWN_FOOD,
+        };
+
+        /// @brief Position of a handle slot's food in the dense array.
+        struct FoodSlot
+        {
+            std::uint32_t index;
+            std::uint32_t generation;
+        };
+
         Core::Point colonyCenter;
         float colonyRadius;
         float foodRadius;
         Core::ViewPort viewPort;
 
         void spawnFood();
+        void addFood(const Core::Point &position, int capacity);
+        void remove(FoodHandle handle);
+
+        /**
+         * @brief Schedules the next spawn after a random wait matching a fixed chance per tick
+         */
+        void scheduleSpawn();
 
-        std::unordered_map<Food *, std::shared_ptr<Food>> foodParticles;
+        /// @brief Food pieces, kept dense by moving the last piece into removed ones.
+        std::vector<Food> foodParticles;
+        /// @brief Slot of each food piece, parallel to foodParticles.
+        std::vector<std::uint32_t> particleSlots;
+        std::vector<FoodSlot> slots;
+        /// @brief Slots of removed food, reused by new food.
+        std::vector<std::uint32_t> freeSlots;
+        /// @brief Food emptied since the last update.
+        std::vector<FoodHandle> depleted;
+        /// @brief Food slots by position, food shrinking as it is taken stays within the grid's loose bounds.
+        Core::LooseGrid grid;
+        /// @brief Upcoming events, one tick per update.
+        Utils::TimingWheel<FOOD_EVENT> events;
+        /// @brief Events firing in the current update, kept to reuse its storage.
+        std::vector<FOOD_EVENT> dueEvents;
+        /// @brief Indices of the food drawn in the current frame, kept to reuse its storage.
+        std::vector<std::uint32_t> visibleFood;
     };
 }
@@ -3,6 +3,8 @@
 #include "../core/point.hpp"
 #include "../core/color.hpp"
 
+#include <algorithm>
+
 namespace AntColony::Simulation
 {
     Pheromone::Pheromone(PheromoneSignal signal, float size, int strength)
@@ -15,6 +17,11 @@ namespace AntColony::Simulation
             strength -= 1;
     }
 
+    void Pheromone::reinforce(int amount, int maxStrength)
+    {
+        strength = std::max(strength, std::min(strength + amount, maxStrength));
+    }
+
     void Pheromone::render(Render::Renderer &renderer)
     {
         renderer.drawCircleInPosition(position, entitySize, Core::Color(mainColor));
@@ -16,6 +16,12 @@ namespace AntColony::Simulation
         void render(Render::Renderer &renderer) override;
         void evaporate();
 
+        /**
+         * @brief Adds the strength of a deposit merged into this pheromone
+         * @param maxStrength Strength is clamped to it, so merged trails fade like a fresh deposit
+         */
+        void reinforce(int amount, int maxStrength);
+
         int getStrength() const;
         Core::Point getPosition() const override;
         float getSize() const override;
@@ -1,56 +1,171 @@
 #include "pheromoneManager.hpp"
+#include "food.hpp"
+
+#include "../core/color.hpp"
+#include "../core/morton.hpp"
+#include "../utils/radixSort.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
 namespace AntColony::Simulation
 {
-    PheromoneManager::PheromoneManager(float pheromoneSize)
-        : PheromoneManager(std::make_shared<Utils::ConsoleLogger>(), pheromoneSize) {}
+    // Heatmap grid resolution, independent of the pheromone count
+    constexpr auto HEATMAP_GRID_SIZE = 128;
+    constexpr auto HEATMAP_COLOR = 0x0335fc;
+    // Strength per unit of excitement, also the lifetime in ticks
+    constexpr auto PHEROMONE_STRENGTH = 50;
+    // Cap of merged pheromones, the strength of the most excited deposit. Ants bite before reading the
+    // capacity, so excitement is at most one less than a full food spot
+    constexpr auto MAX_PHEROMONE_STRENGTH = PHEROMONE_STRENGTH * (MAX_FOOD_CAPACITY - 1);
+    // Coalescing cell edge in pheromone sizes, deposits closer than an ant width share a cell
+    constexpr auto COALESCING_CELL_SCALE = 4.0f;
+
+    PheromoneManager::PheromoneManager(float pheromoneSize, Core::ViewPort viewPort)
+        : PheromoneManager(std::make_shared<Utils::ConsoleLogger>(), pheromoneSize, viewPort) {}
 
-    PheromoneManager::PheromoneManager(std::shared_ptr<Core::Logger> logger, float pheromoneSize)
-        : BaseEntityManager(logger), pheromoneSize(pheromoneSize) {}
+    PheromoneManager::PheromoneManager(std::shared_ptr<Core::Logger> logger, float pheromoneSize, Core::ViewPort viewPort)
+        : BaseEntityManager(logger),
+          pheromoneSize(pheromoneSize),
+          renderMode(CIRCLES),
+          isCoalescing(false),
+          cellSize(pheromoneSize * COALESCING_CELL_SCALE),
+          maxPheromones(0),
+          evictionCount(0),
+          tick(0),
+          expiryBuckets(MAX_PHEROMONE_STRENGTH + 1),
+          maxExpiry(0),
+          maxStrength(0),
+          densityGrid(viewPort, HEATMAP_GRID_SIZE, HEATMAP_GRID_SIZE) {}
 
     void PheromoneManager::update(const std::stack<PheromoneSignal> &signals)
     {
-        std::stack<Pheromone *> toDelete;
-        for (const auto &[ptr, pheromone] : pheromones)
+        tick++;
+        for (std::size_t i = 0; i < pheromones.size();)
         {
-            ptr->evaporate();
-            if (ptr->getStrength() <= 0)
+            pheromones[i].evaporate();
+            if (pheromones[i].getStrength() <= 0)
+            {
+                // The swapped in pheromone still has to evaporate, stay on this index
+                remove(i);
+            }
+            else
             {
-                toDelete.push(ptr);
+                i++;
             }
         }
 
-        while (!toDelete.empty())
+        depositPheromones(signals);
+        updateMaxStrength();
+    }
+
+    void PheromoneManager::render(Render::Renderer &renderer, const Core::ViewPort &visibleArea)
+    {
+        if (renderMode == HEATMAP)
         {
-            auto ptr = toDelete.top();
-            pheromones.erase(ptr);
-            toDelete.pop();
+            renderHeatmap(renderer, visibleArea);
+            return;
         }
 
-        depositPheromones(signals);
+        for (auto &pheromone : pheromones)
+        {
+            if (visibleArea.overlapsCircle(pheromone.getPosition(), pheromone.getSize()))
+                pheromone.render(renderer);
+        }
     }
 
-    void PheromoneManager::render(Render::Renderer &renderer) const
+    void PheromoneManager::renderHeatmap(Render::Renderer &renderer, const Core::ViewPort &visibleArea)
     {
-        for (const auto &[ptr, pheromone] : pheromones)
+        // The grid is drawn as a single quad, cull it as a whole
+        const auto &area = densityGrid.area;
+        if (area.maxX < visibleArea.minX || area.minX > visibleArea.maxX || area.maxY < visibleArea.minY || area.minY > visibleArea.maxY)
+            return;
+
+        densityGrid.clear();
+
+        for (const auto &pheromone : pheromones)
         {
-            ptr->render(renderer);
+            densityGrid.accumulate(pheromone.getPosition(), static_cast<float>(pheromone.getStrength()));
         }
+
+        renderer.drawDensityGrid(densityGrid, Core::Color(HEATMAP_COLOR));
+    }
+
+    void PheromoneManager::setRenderMode(PHEROMONE_RENDER_MODE mode) { renderMode = mode; }
+
+    void PheromoneManager::setCoalescing(bool enabled)
+    {
+        isCoalescing = enabled;
+        cells.clear();
+
+        if (!isCoalescing)
+            return;
+
+        // Pheromones deposited before keep their own entries, the first one of a cell takes the merges
+        for (std::size_t i = 0; i < pheromones.size(); i++)
+            cells.emplace(getCellKey(pheromones[i].getPosition()), i);
+    }
+
+    void PheromoneManager::setMaxPheromones(std::size_t count)
+    {
+        maxPheromones = count;
+
+        // Storage for the whole budget up front, so a capped run does not reallocate
+        pheromones.reserve(count);
+        bucketEntries.reserve(count);
     }
 
+    std::uint64_t PheromoneManager::getEvictionCount() const { return evictionCount; }
+
+    int PheromoneManager::getMaxStrength() const { return maxStrength; }
+
     const std::vector<PheromoneSignal> PheromoneManager::getPheromones() const
     {
         std::vector<PheromoneSignal> result;
         result.reserve(pheromones.size());
 
-        for (const auto &[ptr, pheromone] : pheromones)
+        for (const auto &pheromone : pheromones)
         {
-            result.emplace_back(pheromone->getPosition(), pheromone->getStrength());
+            result.emplace_back(pheromone.getPosition(), pheromone.getStrength());
         }
 
         return result;
     }
 
+    void PheromoneManager::sortByMorton(Utils::WorkerPool *pool)
+    {
+        std::vector<std::uint32_t> keys;
+        keys.reserve(pheromones.size());
+        for (const auto &pheromone : pheromones)
+            keys.push_back(Core::mortonKey(pheromone.getPosition(), densityGrid.area));
+
+        std::vector<std::uint32_t> order;
+        Utils::radixSortOrder(keys, order, pool);
+
+        // Bucket entries and cells hold pheromone indices, move them to the new places
+        std::vector<Pheromone> sorted;
+        std::vector<BucketEntry> sortedEntries;
+        std::vector<std::size_t> newIndices(pheromones.size());
+        sorted.reserve(std::max(pheromones.size(), maxPheromones));
+        sortedEntries.reserve(sorted.capacity());
+
+        for (std::size_t i = 0; i < order.size(); i++)
+        {
+            const auto &entry = bucketEntries[order[i]];
+            expiryBuckets[entry.bucket][entry.position] = i;
+            sortedEntries.push_back(entry);
+            sorted.push_back(std::move(pheromones[order[i]]));
+            newIndices[order[i]] = i;
+        }
+
+        for (auto &[key, index] : cells)
+            index = newIndices[index];
+
+        pheromones.swap(sorted);
+        bucketEntries.swap(sortedEntries);
+    }
+
     void PheromoneManager::depositPheromones(std::stack<PheromoneSignal> positions)
     {
         while (!positions.empty())
@@ -63,7 +178,118 @@ namespace AntColony::Simulation
 
     void PheromoneManager::depositPheromone(PheromoneSignal signal)
     {
-        auto pheromone = std::make_unique<Pheromone>(signal,pheromoneSize,50);
-        pheromones[pheromone.get()] = std::move(pheromone);
+        if (isCoalescing)
+        {
+            const auto cell = cells.find(getCellKey(signal.position));
+            if (cell != cells.end())
+            {
+                untrack(cell->second);
+                pheromones[cell->second].reinforce(PHEROMONE_STRENGTH * signal.excitement, MAX_PHEROMONE_STRENGTH);
+                track(cell->second);
+                return;
+            }
+        }
+
+        if (!makeRoom(PHEROMONE_STRENGTH * signal.excitement))
+            return;
+
+        if (isCoalescing)
+            cells.emplace(getCellKey(signal.position), pheromones.size());
+
+        pheromones.emplace_back(signal, pheromoneSize, PHEROMONE_STRENGTH);
+        track(pheromones.size() - 1);
+    }
+
+    bool PheromoneManager::makeRoom(int strength)
+    {
+        if (maxPheromones == 0 || pheromones.size() < maxPheromones)
+            return true;
+
+        while (pheromones.size() >= maxPheromones)
+        {
+            // The nearest non-empty expiry bucket holds the weakest pheromones
+            std::size_t weakest = pheromones.size();
+            for (std::size_t i = 0; i < expiryBuckets.size() && weakest == pheromones.size(); i++)
+            {
+                const auto &bucket = expiryBuckets[(tick + i) % expiryBuckets.size()];
+                if (!bucket.empty())
+                    weakest = bucket.back();
+            }
+
+            evictionCount++;
+            if (pheromones[weakest].getStrength() >= strength)
+                return false;
+
+            remove(weakest);
+        }
+
+        return true;
+    }
+
+    void PheromoneManager::remove(std::size_t index)
+    {
+        const auto last = pheromones.size() - 1;
+
+        if (isCoalescing)
+        {
+            // Entries may belong to another pheromone of the same cell deposited before coalescing was enabled
+            const auto cell = cells.find(getCellKey(pheromones[index].getPosition()));
+            if (cell != cells.end() && cell->second == index)
+                cells.erase(cell);
+
+            const auto moved = cells.find(getCellKey(pheromones[last].getPosition()));
+            if (index != last && moved != cells.end() && moved->second == last)
+                moved->second = index;
+        }
+
+        untrack(index);
+        if (index != last)
+        {
+            pheromones[index] = std::move(pheromones[last]);
+            bucketEntries[index] = bucketEntries[last];
+            expiryBuckets[bucketEntries[index].bucket][bucketEntries[index].position] = index;
+        }
+        pheromones.pop_back();
+        bucketEntries.pop_back();
+    }
+
+    void PheromoneManager::track(std::size_t index)
+    {
+        // Deposits stay within MAX_PHEROMONE_STRENGTH as excitement comes from the food capacity
+        const auto strength = std::clamp(pheromones[index].getStrength(), 0, MAX_PHEROMONE_STRENGTH);
+        const auto expiry = tick + strength;
+        const auto bucket = static_cast<std::size_t>(expiry % expiryBuckets.size());
+        maxExpiry = std::max(maxExpiry, expiry);
+
+        if (bucketEntries.size() <= index)
+            bucketEntries.resize(index + 1);
+        bucketEntries[index] = {bucket, expiryBuckets[bucket].size()};
+        expiryBuckets[bucket].push_back(index);
+    }
+
+    void PheromoneManager::updateMaxStrength()
+    {
+        // The latest expiry only moves down here, by at most MAX_PHEROMONE_STRENGTH per deposit over the run
+        while (maxExpiry > tick && expiryBuckets[maxExpiry % expiryBuckets.size()].empty())
+            maxExpiry--;
+
+        maxStrength = maxExpiry > tick ? static_cast<int>(maxExpiry - tick) : 0;
+    }
+
+    void PheromoneManager::untrack(std::size_t index)
+    {
+        const auto [bucket, position] = bucketEntries[index];
+        auto &entries = expiryBuckets[bucket];
+
+        entries[position] = entries.back();
+        bucketEntries[entries[position]].position = position;
+        entries.pop_back();
+    }
+
+    std::int64_t PheromoneManager::getCellKey(const Core::Point &position) const
+    {
+        const auto x = static_cast<std::int32_t>(std::floor(position.x / cellSize));
+        const auto y = static_cast<std::int32_t>(std::floor(position.y / cellSize));
+        return static_cast<std::int64_t>((static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y));
     }
 }
@@ -3,9 +3,14 @@
 #include "baseEntityManager.hpp"
 #include "pheromone.hpp"
 #include "pheromoneSignal.hpp"
+#include "pheromoneRenderMode.hpp"
 
 #include "../core/logger.hpp"
+#include "../core/viewPort.hpp"
+#include "../core/densityGrid.hpp"
+#include "../utils/_fwd.hpp"
 
+#include <cstdint>
 #include <vector>
 #include <stack>
 #include <memory>
@@ -16,19 +21,97 @@ namespace AntColony::Simulation
     class PheromoneManager : public BaseEntityManager
     {
     public:
-        explicit PheromoneManager(float pheromoneSize);
+        PheromoneManager(float pheromoneSize, Core::ViewPort viewPort);
 
-        explicit PheromoneManager(std::shared_ptr<Core::Logger> logger, float pheromoneSize);
+        PheromoneManager(std::shared_ptr<Core::Logger> logger, float pheromoneSize, Core::ViewPort viewPort);
 
         void update(const std::stack<PheromoneSignal> &signals);
-        void render(Render::Renderer &renderer) const;
+        /**
+         * @brief Renders the pheromones overlapping the visible area, pheromones outside are culled
+         */
+        void render(Render::Renderer &renderer, const Core::ViewPort &visibleArea);
+
+        /**
+         * @brief Selects between per-pheromone circles and the density heatmap
+         */
+        void setRenderMode(PHEROMONE_RENDER_MODE mode);
+
+        /**
+         * @brief Merges deposits into the pheromone already in their cell instead of adding new ones
+         *
+         * Busy trails then keep one pheromone per cell, so the count follows the trail length instead of the traffic.
+         */
+        void setCoalescing(bool enabled);
+
+        /**
+         * @brief Bounds the live pheromones, a deposit over the limit evicts the weakest pheromone
+         *
+         * The deposit itself is dropped when it would be the weakest. Lowering the limit takes effect on the next deposit.
+         * @param count Maximum live pheromones, 0 for no limit
+         */
+        void setMaxPheromones(std::size_t count);
+
+        /**
+         * @brief Pheromones evicted or dropped because of the limit since construction
+         */
+        std::uint64_t getEvictionCount() const;
+
+        /**
+         * @brief Strength of the strongest live pheromone, 0 when there is none, without scanning them
+         */
+        int getMaxStrength() const;
 
         const std::vector<PheromoneSignal> getPheromones() const;
 
+        /**
+         * @brief Reorders the pheromones by Morton key of their position, so pheromones near in space are near in memory
+         * @param pool Threads for the sort, null sorts on the calling thread
+         */
+        void sortByMorton(Utils::WorkerPool *pool);
+
     private:
-        std::unordered_map<Pheromone *, std::shared_ptr<Pheromone>> pheromones;
+        /// @brief Dense storage, removal swaps the last pheromone into the freed place.
+        std::vector<Pheromone> pheromones;
         float pheromoneSize;
+        PHEROMONE_RENDER_MODE renderMode;
+
+        bool isCoalescing;
+        float cellSize;
+        /// @brief Pheromone index by cell key, only filled while coalescing.
+        std::unordered_map<std::int64_t, std::size_t> cells;
+
+        struct BucketEntry
+        {
+            std::size_t bucket;
+            std::size_t position;
+        };
+
+        std::size_t maxPheromones;
+        std::uint64_t evictionCount;
+        /// @brief Updates since construction, a pheromone expires at the tick of its deposit plus its strength.
+        std::uint64_t tick;
+        /// @brief Pheromone indices by expiry tick modulo the ring size, all decay alike so this orders them by strength.
+        std::vector<std::vector<std::size_t>> expiryBuckets;
+        /// @brief Place of each pheromone in expiryBuckets.
+        std::vector<BucketEntry> bucketEntries;
+        /// @brief Latest expiry tick of a tracked pheromone, may point at an emptied bucket until the next update.
+        std::uint64_t maxExpiry;
+        /// @brief Strength of the strongest pheromone at the end of the last update.
+        int maxStrength;
+
+        /**
+         * @brief Heatmap accumulation buffer, reused across frames
+         */
+        Core::DensityGrid densityGrid;
+
+        void renderHeatmap(Render::Renderer &renderer, const Core::ViewPort &visibleArea);
         void depositPheromone(PheromoneSignal signal);
         void depositPheromones(std::stack<PheromoneSignal> positions);
+        void remove(std::size_t index);
+        bool makeRoom(int strength);
+        void track(std::size_t index);
+        void untrack(std::size_t index);
+        void updateMaxStrength();
+        std::int64_t getCellKey(const Core::Point &position) const;
     };
 }
\ No newline at end of file
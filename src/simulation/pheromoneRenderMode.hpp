@@ -0,0 +1,15 @@
+#pragma once
+
+namespace AntColony::Simulation
+{
+    /**
+     * @brief How PheromoneManager draws the pheromone field.
+     */
+    enum PHEROMONE_RENDER_MODE
+    {
+        /// @brief Every pheromone is drawn as its own circle.
+        CIRCLES,
+        /// @brief Strengths are accumulated into a low-resolution grid drawn as one quad.
+        HEATMAP,
+    };
+}
@@ -1,5 +1,7 @@
 #include "simulation.hpp"
 
+#include "../render/camera.hpp"
+
 namespace AntColony::Simulation
 {
     // Constants for ant behavior and simulation parameters
@@ -21,13 +23,16 @@ namespace AntColony::Simulation
                            float pheromoneSize)
         : logger(logger),
           colony(colonyCenter, colonySize),
-          foodManager(colonyCenter,
+          foodManager(logger,
+                      colonyCenter,
                       colonySize,
                       foodSize,
                       viewPort),
-          antManager(viewPort),
-          pheromoneManager(pheromoneSize),
-          foodCounter(Core::Point(viewPort.minX + 2 * 0.05f, viewPort.maxY - 2 * 0.05f), 0.1f)
+          antManager(logger, viewPort),
+          pheromoneManager(logger, pheromoneSize, viewPort),
+          foodCounter(Core::Point(viewPort.minX + 2 * 0.05f, viewPort.maxY - 2 * 0.05f), 0.1f),
+          reorderInterval(0),
+          ticksSinceReorder(0)
 
     {
         antManager.spawnAnts(colony, antSize);
@@ -47,23 +52,72 @@ namespace AntColony::Simulation
 
     void Simulation::update(const Render::FrameContext &ctx)
     {
-        const auto &food = foodManager.getFoodParticles();
         const auto &pheromones = pheromoneManager.getPheromones();
 
-        const auto poisitions = antManager.update(colony, foodCounter, food, pheromones);
+        const auto poisitions = antManager.update(colony, foodCounter, foodManager, pheromones, pheromoneManager.getMaxStrength());
 
         pheromoneManager.update(poisitions);
+
+        // Also removes the food emptied by the ants
         foodManager.update();
+
+        if (reorderInterval > 0 && ++ticksSinceReorder >= reorderInterval)
+        {
+            antManager.sortByMorton(workerPool.get());
+            pheromoneManager.sortByMorton(workerPool.get());
+            ticksSinceReorder = 0;
+        }
+    }
+
+    void Simulation::setPheromoneRenderMode(PHEROMONE_RENDER_MODE mode)
+    {
+        pheromoneManager.setRenderMode(mode);
+    }
+
+    void Simulation::setPheromoneCoalescing(bool enabled)
+    {
+        pheromoneManager.setCoalescing(enabled);
+    }
+
+    void Simulation::setMaxPheromones(std::size_t count)
+    {
+        pheromoneManager.setMaxPheromones(count);
+    }
+
+    std::uint64_t Simulation::getPheromoneEvictions() const
+    {
+        return pheromoneManager.getEvictionCount();
+    }
+
+    void Simulation::setReorderInterval(int ticks)
+    {
+        reorderInterval = ticks;
+        ticksSinceReorder = 0;
+
+        if (reorderInterval > 0 && !workerPool)
+            workerPool = std::make_unique<Utils::WorkerPool>();
+    }
+
+    void Simulation::seedFood(std::size_t count)
+    {
+        foodManager.seedFood(count);
     }
 
     void Simulation::render(const Render::FrameContext &ctx)
     {
-        auto &renderer = *ctx.getRenderer().get();
+        auto &renderer = ctx.getRenderer();
+        const auto visibleArea = ctx.getCamera().getVisibleArea();
+
+        // The colony never moves, it is drawn once into the cached background
+        if (renderer.beginStaticLayer() && visibleArea.overlapsCircle(colony.getPosition(), colony.getSize()))
+            colony.render(renderer);
+        renderer.endStaticLayer();
+
+        antManager.render(renderer, ctx.getCamera());
+        foodManager.render(renderer, visibleArea);
+        pheromoneManager.render(renderer, visibleArea);
 
-        colony.render(renderer);
-        antManager.render(renderer);
-        foodManager.render(renderer);
-        pheromoneManager.render(renderer);
+        // Drawn in view coordinates, stays in place as a HUD
         foodCounter.render(renderer);
     }
 }
@@ -8,6 +8,7 @@
 
 #include "../core/logger.hpp"
 #include "../render/frameContext.hpp"
+#include "../utils/workerPool.hpp"
 
 namespace AntColony::Simulation
 {
@@ -27,6 +28,36 @@ namespace AntColony::Simulation
         void update(const Render::FrameContext &ctx);
         void render(const Render::FrameContext &ctx);
 
+        /**
+         * @brief Selects how pheromones are drawn
+         */
+        void setPheromoneRenderMode(PHEROMONE_RENDER_MODE mode);
+
+        /**
+         * @brief Merges pheromone deposits into the pheromone already in their cell
+         */
+        void setPheromoneCoalescing(bool enabled);
+
+        /**
+         * @brief Bounds the live pheromones, the weakest are evicted first, 0 for no limit
+         */
+        void setMaxPheromones(std::size_t count);
+
+        /**
+         * @brief Pheromones evicted by the limit so far
+         */
+        std::uint64_t getPheromoneEvictions() const;
+
+        /**
+         * @brief Places food patches before the first tick, spread evenly without overlap
+         */
+        void seedFood(std::size_t count);
+
+        /**
+         * @brief Sorts ants and pheromones into Morton order every given number of ticks, 0 never
+         */
+        void setReorderInterval(int ticks);
+
     private:
         Simulation(
             std::shared_ptr<Core::Logger> logger,
@@ -43,5 +74,10 @@ namespace AntColony::Simulation
         AntManager antManager;
         PheromoneManager pheromoneManager;
         Counter foodCounter;
+
+        int reorderInterval;
+        int ticksSinceReorder;
+        /// @brief Threads for the reorder sorts, started when reordering is enabled.
+        std::unique_ptr<Utils::WorkerPool> workerPool;
     };
 }
\ No newline at end of file
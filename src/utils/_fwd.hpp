@@ -0,0 +1,6 @@
+namespace AntColony::Utils
+{
+    class ConsoleLogger;
+    class RandomGenerator;
+    class WorkerPool;
+}
\ No newline at end of file
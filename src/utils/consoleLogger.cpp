@@ -10,21 +10,22 @@ namespace AntColony::Utils
     const char *YELLOW = "\033[33m";
     const char *RED = "\033[31m";
 
-    ConsoleLogger::ConsoleLogger() {}
+    ConsoleLogger::ConsoleLogger() : ConsoleLogger(std::cout) {}
+    ConsoleLogger::ConsoleLogger(std::ostream &output) : output(output) {}
 
     void ConsoleLogger::debug(const std::string &message)
     {
-        std::cout << CYAN << "[DEBUG]" << " " << message << RESET<< std::endl;
+        output << CYAN << "[DEBUG]" << " " << message << RESET<< std::endl;
     }
 
     void ConsoleLogger::info(const std::string &message)
     {
-        std::cout << GREEN << "[INFO]" << " " << message << RESET << std::endl;
+        output << GREEN << "[INFO]" << " " << message << RESET << std::endl;
     }
 
     void ConsoleLogger::warning(const std::string &message)
     {
-        std::cout << YELLOW << "[WARNING]" << " " << message << RESET << std::endl;
+        output << YELLOW << "[WARNING]" << " " << message << RESET << std::endl;
     }
 
     void ConsoleLogger::error(const std::string &message)
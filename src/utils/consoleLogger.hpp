@@ -1,6 +1,8 @@
 #pragma once
 #include "../core/logger.hpp"
 
+#include <ostream>
+
 namespace AntColony::Utils
 {
     class ConsoleLogger : public AntColony::Core::Logger
@@ -8,9 +10,17 @@ namespace AntColony::Utils
     public:
         ConsoleLogger();
 
+        /**
+         *  @brief Logger writing non-error messages to a given stream, e.g. stderr when stdout carries data
+         */
+        explicit ConsoleLogger(std::ostream &output);
+
         void debug(const std::string &message) override;
         void info(const std::string &message) override;
         void warning(const std::string &message) override;
         void error(const std::string &message) override;
+
+    private:
+        std::ostream &output;
     };
 }
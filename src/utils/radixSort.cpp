@@ -0,0 +1,83 @@
+#include "radixSort.hpp"
+#include "workerPool.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace AntColony::Utils
+{
+    // Bits per pass, four passes cover 32-bit keys
+    constexpr const int RADIX_BITS = 8;
+    constexpr const std::size_t RADIX_SIZE = 1 << RADIX_BITS;
+    constexpr const std::uint32_t RADIX_MASK = RADIX_SIZE - 1;
+    // Below this many keys waking the pool costs more than the sort
+    constexpr const std::size_t PARALLEL_THRESHOLD = 1 << 14;
+
+    void radixSortOrder(const std::vector<std::uint32_t> &keys, std::vector<std::uint32_t> &order, WorkerPool *pool)
+    {
+        const auto count = keys.size();
+        order.resize(count);
+        std::iota(order.begin(), order.end(), 0);
+
+        if (count < 2)
+            return;
+
+        const std::size_t chunkCount = pool && count >= PARALLEL_THRESHOLD ? pool->getThreadCount() : 1;
+        const auto chunkSize = (count + chunkCount - 1) / chunkCount;
+
+        // Keys travel with their indices so passes read them sequentially
+        auto sortedKeys = keys;
+        std::vector<std::uint32_t> scratchKeys(count);
+        std::vector<std::uint32_t> scratchOrder(count);
+        std::vector<std::size_t> offsets(chunkCount * RADIX_SIZE);
+
+        const auto forEachChunk = [&](const auto &job)
+        {
+            if (chunkCount > 1)
+                pool->parallelFor(chunkCount, job);
+            else
+                job(0);
+        };
+
+        for (auto shift = 0; shift < 32; shift += RADIX_BITS)
+        {
+            forEachChunk([&](std::size_t chunk)
+                         {
+                             auto *histogram = &offsets[chunk * RADIX_SIZE];
+                             std::fill(histogram, histogram + RADIX_SIZE, 0);
+
+                             const auto end = std::min(count, (chunk + 1) * chunkSize);
+                             for (auto i = chunk * chunkSize; i < end; i++)
+                                 histogram[(sortedKeys[i] >> shift) & RADIX_MASK]++;
+                         });
+
+            // Digits first, then chunks in input order, keeps equal digits in their previous order
+            std::size_t position = 0;
+            for (std::size_t digit = 0; digit < RADIX_SIZE; digit++)
+            {
+                for (std::size_t chunk = 0; chunk < chunkCount; chunk++)
+                {
+                    const auto digitCount = offsets[chunk * RADIX_SIZE + digit];
+                    offsets[chunk * RADIX_SIZE + digit] = position;
+                    position += digitCount;
+                }
+            }
+
+            forEachChunk([&](std::size_t chunk)
+                         {
+                             auto *next = &offsets[chunk * RADIX_SIZE];
+
+                             const auto end = std::min(count, (chunk + 1) * chunkSize);
+                             for (auto i = chunk * chunkSize; i < end; i++)
+                             {
+                                 const auto target = next[(sortedKeys[i] >> shift) & RADIX_MASK]++;
+                                 scratchKeys[target] = sortedKeys[i];
+                                 scratchOrder[target] = order[i];
+                             }
+                         });
+
+            sortedKeys.swap(scratchKeys);
+            order.swap(scratchOrder);
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "_fwd.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace AntColony::Utils
+{
+    /**
+     * @brief Stable ascending order of 32-bit keys by a least significant digit radix sort.
+     *
+     * Large inputs are split into one chunk per pool thread: each pass counts digits per chunk in parallel,
+     * a prefix sum over digits and chunks places every chunk, then the chunks scatter in parallel.
+     * @param keys Keys to order, left untouched.
+     * @param order Receives the indices of the keys from the smallest key to the largest.
+     * @param pool Threads to sort with, null sorts on the calling thread.
+     */
+    void radixSortOrder(const std::vector<std::uint32_t> &keys, std::vector<std::uint32_t> &order, WorkerPool *pool);
+}
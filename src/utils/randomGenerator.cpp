@@ -30,4 +30,11 @@ namespace AntColony::Utils
         std::uniform_real_distribution<float> dist(min, max);
         return dist(engine);
     }
+
+    int RandomGenerator::getGeometric(float probability)
+    {
+        // The distribution counts failures before the first success
+        std::geometric_distribution<int> dist(probability);
+        return dist(engine) + 1;
+    }
 }
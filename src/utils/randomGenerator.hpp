@@ -31,6 +31,12 @@ namespace AntColony::Utils
          */
         float getFloat(float min, float max);
 
+        /**
+         *  @brief Generate the number of trials up to and including the first success, each succeeding with probability
+         *         in (0, 1], e.g. the ticks until a per-tick chance fires
+         */
+        int getGeometric(float probability);
+
     private:
         RandomGenerator();
         std::mt19937 engine;
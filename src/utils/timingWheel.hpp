@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace AntColony::Utils
+{
+    /**
+     * @brief Tick-indexed event queue, a hashed timing wheel.
+     *
+     * An event goes to the bucket of its tick modulo the wheel size, events further than one revolution
+     * away stay in their bucket until their tick comes. Advancing visits one bucket per tick, or every
+     * bucket once when jumping further than a revolution, so quiet stretches are skipped cheaply.
+     */
+    template <typename Event>
+    class TimingWheel
+    {
+    public:
+        /**
+         * @brief Creates an empty wheel at tick 0.
+         * @param size Number of buckets, events are cheapest when scheduled less than size ticks ahead.
+         */
+        explicit TimingWheel(std::size_t size) : buckets(size > 0 ? size : 1), now(0), pendingCount(0) {}
+
+        /**
+         * @brief Schedules an event, ticks not after the current one fire on the next advance.
+         */
+        void schedule(std::uint64_t tick, Event event)
+        {
+            tick = tick > now ? tick : now + 1;
+            buckets[tick % buckets.size()].push_back({tick, std::move(event)});
+            pendingCount++;
+        }
+
+        /**
+         * @brief Moves to a later tick and appends the events due up to it to due, in tick order per bucket.
+         */
+        void advance(std::uint64_t tick, std::vector<Event> &due)
+        {
+            if (tick <= now)
+                return;
+
+            if (pendingCount > 0)
+            {
+                // A jump over a full revolution visits each bucket once instead of once per tick
+                const auto steps = tick - now;
+                const auto visited = steps < buckets.size() ? steps : buckets.size();
+                for (std::uint64_t i = 1; i <= visited; i++)
+                    collect(buckets[(now + i) % buckets.size()], tick, due);
+            }
+
+            now = tick;
+        }
+
+        std::uint64_t getNow() const { return now; }
+        std::size_t getPendingCount() const { return pendingCount; }
+
+    private:
+        struct Entry
+        {
+            std::uint64_t tick;
+            Event event;
+        };
+
+        std::vector<std::vector<Entry>> buckets;
+        std::uint64_t now;
+        std::size_t pendingCount;
+
+        void collect(std::vector<Entry> &bucket, std::uint64_t tick, std::vector<Event> &due)
+        {
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < bucket.size(); i++)
+            {
+                if (bucket[i].tick <= tick)
+                {
+                    due.push_back(std::move(bucket[i].event));
+                    pendingCount--;
+                }
+                else
+                {
+                    if (i != kept)
+                        bucket[kept] = std::move(bucket[i]);
+                    kept++;
+                }
+            }
+            bucket.erase(bucket.begin() + kept, bucket.end());
+        }
+    };
+}
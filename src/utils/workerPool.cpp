@@ -0,0 +1,98 @@
+#include "workerPool.hpp"
+
+#include <algorithm>
+
+namespace AntColony::Utils
+{
+    WorkerPool::WorkerPool(unsigned int threadCount)
+        : task(nullptr),
+          invokeTask(nullptr),
+          taskCount(0),
+          nextIndex(0),
+          busyWorkers(0),
+          generation(0),
+          stopping(false)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        // The calling thread is the first worker
+        workers.reserve(threadCount - 1);
+        for (auto i = 1u; i < threadCount; i++)
+            workers.emplace_back(&WorkerPool::workerLoop, this);
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeCondition.notify_all();
+
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    void WorkerPool::run(std::size_t count, const void *job, TaskInvoker invoke)
+    {
+        if (count == 0)
+            return;
+
+        if (workers.empty() || count == 1)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                invoke(job, i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = job;
+            invokeTask = invoke;
+            taskCount = count;
+            nextIndex.store(0, std::memory_order_relaxed);
+            busyWorkers = workers.size();
+            generation++;
+        }
+        wakeCondition.notify_all();
+
+        drain();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCondition.wait(lock, [this]
+                           { return busyWorkers == 0; });
+        task = nullptr;
+    }
+
+    unsigned int WorkerPool::getThreadCount() const { return static_cast<unsigned int>(workers.size() + 1); }
+
+    void WorkerPool::workerLoop()
+    {
+        std::uint64_t seenGeneration = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeCondition.wait(lock, [this, seenGeneration]
+                                   { return stopping || generation != seenGeneration; });
+                if (stopping)
+                    return;
+                seenGeneration = generation;
+            }
+
+            drain();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--busyWorkers == 0)
+                doneCondition.notify_one();
+        }
+    }
+
+    void WorkerPool::drain()
+    {
+        for (auto i = nextIndex.fetch_add(1, std::memory_order_relaxed); i < taskCount; i = nextIndex.fetch_add(1, std::memory_order_relaxed))
+            invokeTask(task, i);
+    }
+}
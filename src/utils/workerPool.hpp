@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AntColony::Utils
+{
+    /**
+     * @brief Fixed set of worker threads for data-parallel loops.
+     *
+     * Threads are started once and parked between jobs. Jobs are passed by reference rather than wrapped
+     * in std::function, so issuing one allocates nothing whatever the lambda captures.
+     */
+    class WorkerPool
+    {
+    public:
+        /**
+         * @brief Starts the workers.
+         * @param threadCount Total number of threads including the caller, 0 selects the hardware concurrency.
+         */
+        explicit WorkerPool(unsigned int threadCount = 0);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool &) = delete;
+        WorkerPool &operator=(const WorkerPool &) = delete;
+
+        /**
+         * @brief Runs job(index) for every index in [0, count) and returns when all are done.
+         *
+         * Indices are handed out dynamically, the calling thread takes part in the work.
+         */
+        template <typename Job>
+        void parallelFor(std::size_t count, const Job &job)
+        {
+            run(count, &job, [](const void *task, std::size_t index)
+                { (*static_cast<const Job *>(task))(index); });
+        }
+
+        /**
+         *  @brief Number of threads taking part in a job, including the caller
+         */
+        unsigned int getThreadCount() const;
+
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wakeCondition;
+        std::condition_variable doneCondition;
+
+        using TaskInvoker = void (*)(const void *task, std::size_t index);
+
+        const void *task;
+        TaskInvoker invokeTask;
+        std::size_t taskCount;
+        std::atomic<std::size_t> nextIndex;
+        std::size_t busyWorkers;
+        std::uint64_t generation;
+        bool stopping;
+
+        void run(std::size_t count, const void *job, TaskInvoker invoke);
+        void workerLoop();
+        void drain();
+    };
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <type_traits>
+
+#include "../../src/core/vec2.hpp"
+#include "../../src/core/vec2Batch.hpp"
+
+using namespace AntColony::Core;
+
+namespace AntColony::Test::Core
+{
+    static_assert(std::is_trivially_default_constructible_v<Vec2>);
+    static_assert(std::is_trivially_copyable_v<Vec2>);
+    static_assert((Vec2(1.0f, 2.0f) + Vec2(3.0f, 4.0f)).dot(Vec2(1.0f, 1.0f)) == 10.0f);
+    static_assert(Vec2(3.0f, 4.0f).distanceSquaredTo(Vec2(0.0f, 0.0f)) == 25.0f);
+
+    namespace
+    {
+        bool isSameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+        // Runs every lane operation on random inputs and compares the bits with the scalar result
+        template <typename Lanes, int LANE_COUNT>
+        void requireScalarResults()
+        {
+            std::mt19937 random(5);
+            std::uniform_real_distribution<float> value(-2.0f, 2.0f);
+
+            for (auto round = 0; round < 1000; round++)
+            {
+                float a[LANE_COUNT], b[LANE_COUNT], c[LANE_COUNT];
+                for (auto i = 0; i < LANE_COUNT; i++)
+                {
+                    a[i] = value(random);
+                    // Zeros and ties exercise the division, min, max and select edge cases
+                    b[i] = i % 3 == 0 ? 0.0f : (i % 3 == 1 ? a[i] : value(random));
+                    c[i] = value(random);
+                }
+
+                const auto la = Lanes::load(a);
+                const auto lb = Lanes::load(b);
+                const auto lc = Lanes::load(c);
+
+                float sum[LANE_COUNT], quotient[LANE_COUNT], root[LANE_COUNT], low[LANE_COUNT], high[LANE_COUNT], selected[LANE_COUNT], length[LANE_COUNT];
+                (la + lb * lc - la).store(sum);
+                (la / lb).store(quotient);
+                sqrt(la * la + lc * lc).store(root);
+                min(la, lb).store(low);
+                max(la, lb).store(high);
+                selectGreater(la, lb, lc, la).store(selected);
+                Vec2Batch<Lanes>(la, lc).length().store(length);
+
+                for (auto i = 0; i < LANE_COUNT; i++)
+                {
+                    REQUIRE(isSameBits(sum[i], a[i] + b[i] * c[i] - a[i]));
+                    REQUIRE(isSameBits(quotient[i], a[i] / b[i]));
+                    REQUIRE(isSameBits(root[i], std::sqrt(a[i] * a[i] + c[i] * c[i])));
+                    REQUIRE(isSameBits(low[i], std::min(a[i], b[i])));
+                    REQUIRE(isSameBits(high[i], std::max(a[i], b[i])));
+                    REQUIRE(isSameBits(selected[i], a[i] > b[i] ? c[i] : a[i]));
+                    REQUIRE(isSameBits(length[i], Vec2(a[i], c[i]).length()));
+                }
+            }
+        }
+    }
+
+    TEST_CASE("Vec2 batches round like scalar Vec2 math", "[vec2]")
+    {
+        requireScalarResults<Floatx4, 4>();
+        requireScalarResults<Floatx8, 8>();
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "../src/render/renderer.hpp"
+#include "../src/core/color.hpp"
+#include "../src/core/densityGrid.hpp"
+#include "../src/core/point.hpp"
+
+#include <vector>
+
+namespace AntColony::Test
+{
+    class RecordingRenderer : public AntColony::Render::Renderer
+    {
+    public:
+        struct Circle
+        {
+            AntColony::Core::Point position;
+            float radius;
+            float r, g, b;
+        };
+
+        std::vector<Circle> circles;
+        std::vector<AntColony::Core::DensityGrid> densityGrids;
+        std::vector<AntColony::Core::DensityGrid> coverageGrids;
+
+        void drawCircleInPosition(const AntColony::Core::Point &position, const float radius, const AntColony::Core::Color &color) override
+        {
+            circles.push_back({position, radius, color.r, color.g, color.b});
+        }
+
+        void drawText(const AntColony::Core::Point &position, const std::string &text, const AntColony::Core::Color &color, const float fontSize) override {}
+
+        void drawDensityGrid(const AntColony::Core::DensityGrid &grid, const AntColony::Core::Color &color) override
+        {
+            densityGrids.push_back(grid);
+        }
+
+        void drawCoverageGrid(const AntColony::Core::DensityGrid &grid, const AntColony::Core::Color &color) override
+        {
+            coverageGrids.push_back(grid);
+        }
+
+        bool beginStaticLayer() override { return true; }
+        void endStaticLayer() override {}
+        void invalidateStaticLayer() override {}
+    };
+}
@@ -0,0 +1,49 @@
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+
+#include "../../src/simulation/antManager.hpp"
+#include "../../src/simulation/colony.hpp"
+#include "../../src/render/camera.hpp"
+#include "../../src/core/point.hpp"
+#include "../../src/core/viewPort.hpp"
+#include "../fakeLogger.hpp"
+#include "../recordingRenderer.hpp"
+
+using namespace AntColony::Simulation;
+using namespace AntColony::Core;
+
+namespace AntColony::Test::Simulation
+{
+    namespace
+    {
+        constexpr auto ANT_SIZE = 0.05f;
+        constexpr auto FRAME_SIZE = 720;
+    }
+
+    TEST_CASE("AntManager splats ants smaller than a pixel into one coverage grid", "[antmanager]")
+    {
+        AntManager manager(std::make_shared<FakeLogger>(), ViewPort(-1.0f, -1.0f, 1.0f, 1.0f));
+        manager.spawnAnts(Colony(Point(0.0f, 0.0f), 0.5f), ANT_SIZE);
+
+        Render::Camera camera;
+        camera.setViewportSize(FRAME_SIZE, FRAME_SIZE);
+
+        // Default zoom draws every ant as circles
+        RecordingRenderer close;
+        manager.render(close, camera);
+        REQUIRE_FALSE(close.circles.empty());
+        REQUIRE(close.coverageGrids.empty());
+
+        // Zoomed out as far as the camera goes the ants are well below a pixel
+        camera.zoomAt(0.0f, Point(0.0f, 0.0f));
+        REQUIRE(camera.worldToPixels(ANT_SIZE) < 1.0f);
+
+        RecordingRenderer far;
+        manager.render(far, camera);
+        REQUIRE(far.circles.empty());
+        REQUIRE(far.coverageGrids.size() == 1);
+
+        const auto &grid = far.coverageGrids[0];
+        REQUIRE(std::accumulate(grid.cells.begin(), grid.cells.end(), 0.0f) > 0.0f);
+    }
+}
@@ -5,6 +5,7 @@
 #include "foodManagerFixture.hpp"
 #include "foodDistributionVisualizer.hpp"
 #include "foodDistributionAnalyzer.hpp"
+#include "../recordingRenderer.hpp"
 
 namespace AntColony::Test::Simulation
 {
@@ -36,7 +37,7 @@ namespace AntColony::Test::Simulation
 
         for (const auto &food : foodParticles)
         {
-            const auto &point = food->getPosition();
+            const auto &point = food.getPosition();
 
             // Add all food particles to the analyzer
             analyzer.addPoint(point.x, point.y);
@@ -45,7 +46,7 @@ namespace AntColony::Test::Simulation
             visualizer.addPoint(point);
 
             // Additionally, check that food particles are outside the colony
-            Point foodPos = food->getPosition();
+            Point foodPos = food.getPosition();
             float distanceFromColony = std::sqrt(
                 std::pow(foodPos.x - fixture.colonyCenter.x, 2) +
                 std::pow(foodPos.y - fixture.colonyCenter.y, 2));
@@ -65,4 +66,146 @@ namespace AntColony::Test::Simulation
         // For a uniform random distribution, we expect some variation, but not too much
         REQUIRE(coeffOfVariation < 0.5);
     }
+
+    TEST_CASE("FoodManager removes emptied food on update", "[foodmanager]")
+    {
+        FoodManagerFixture fixture;
+
+        const auto foodParticles = fixture.runUpdateForFrames(10000);
+        REQUIRE(foodParticles.size() > 1);
+
+        // Emptied food stays addressable until the removal, handles of other food keep resolving after it
+        const auto emptied = fixture.foodManager->getHandle(0);
+        const auto kept = fixture.foodManager->getHandle(foodParticles.size() - 1);
+        const auto keptPosition = foodParticles.back().getPosition();
+
+        while (fixture.foodManager->take(emptied).getCapacity() > 0)
+            ;
+
+        REQUIRE(fixture.foodManager->tryGet(emptied) != nullptr);
+        REQUIRE(fixture.foodManager->getFoodParticles().size() == foodParticles.size());
+
+        fixture.foodManager->removeDepleted();
+
+        REQUIRE(fixture.foodManager->tryGet(emptied) == nullptr);
+        REQUIRE(fixture.foodManager->getFoodParticles().size() == foodParticles.size() - 1);
+
+        const auto *keptFood = fixture.foodManager->tryGet(kept);
+        REQUIRE(keptFood != nullptr);
+        REQUIRE(keptFood->getPosition().x == keptPosition.x);
+        REQUIRE(keptFood->getPosition().y == keptPosition.y);
+
+        REQUIRE(fixture.runUpdateForFramesAndRemove(1000) == 0);
+    }
+
+    TEST_CASE("FoodManager finds the same food collisions as a linear scan", "[foodmanager]")
+    {
+        FoodManagerFixture fixture;
+        const auto foodParticles = fixture.runUpdateForFrames(100000);
+
+        // Empty some food so shrunk and depleted pieces are covered too
+        for (std::size_t i = 0; i < foodParticles.size(); i += 3)
+            fixture.foodManager->take(fixture.foodManager->getHandle(i));
+
+        const auto &food = fixture.foodManager->getFoodParticles();
+        const auto radius = 2.0f;
+
+        for (auto x = fixture.viewport.minX; x < fixture.viewport.maxX; x += 5.0f)
+        {
+            for (auto y = fixture.viewport.minY; y < fixture.viewport.maxY; y += 5.0f)
+            {
+                const Point position(x, y);
+
+                auto expected = food.size();
+                for (std::size_t i = 0; i < food.size(); i++)
+                {
+                    if (food[i].getCapacity() > 0 && position.distanceTo(food[i].getPosition()) < radius + food[i].getSize())
+                    {
+                        expected = i;
+                        break;
+                    }
+                }
+
+                const auto handle = fixture.foodManager->findCollision(position, radius);
+                if (expected == food.size())
+                {
+                    REQUIRE_FALSE(handle.isValid());
+                }
+                else
+                {
+                    REQUIRE(fixture.foodManager->tryGet(handle) == &food[expected]);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("FoodManager seeds non-overlapping food evenly", "[foodmanager]")
+    {
+        FoodManagerFixture fixture;
+
+        // Seeding has to avoid food that spawned before as well
+        const auto spawned = fixture.runUpdateForFrames(5000).size();
+        const auto seeded = fixture.foodManager->seedFood(100);
+        REQUIRE(seeded == 100);
+
+        const auto &food = fixture.foodManager->getFoodParticles();
+        REQUIRE(food.size() == spawned + seeded);
+
+        // Saturating fills all the remaining space
+        REQUIRE(fixture.foodManager->seedFood(100000) > 0);
+
+        float maxRadius = std::min(std::min(-fixture.viewport.minX, -fixture.viewport.minY), std::min(fixture.viewport.maxX, fixture.viewport.maxY));
+        RadialDistributionAnalyzer analyzer(fixture.colonyCenter, fixture.colonyRadius, maxRadius, 10);
+
+        for (std::size_t i = 0; i < food.size(); i++)
+        {
+            const auto &position = food[i].getPosition();
+            analyzer.addPoint(position.x, position.y);
+
+            REQUIRE(fixture.viewport.checkViewportBoundaries(position));
+            REQUIRE(position.distanceTo(fixture.colonyCenter) >= fixture.colonyRadius);
+
+            // Only seeded food is guaranteed apart, spawned food may overlap other spawned food
+            for (std::size_t j = std::max(i + 1, spawned); j < food.size(); j++)
+                REQUIRE(position.distanceTo(food[j].getPosition()) >= food[i].getSize() + food[j].getSize());
+        }
+
+        REQUIRE(analyzer.calculateCoefficientOfVariation() < 0.5);
+    }
+
+    TEST_CASE("FoodManager renders the same food as a linear scan of the visible area", "[foodmanager]")
+    {
+        FoodManagerFixture fixture;
+        fixture.runUpdateForFrames(100000);
+        const auto &food = fixture.foodManager->getFoodParticles();
+
+        // Areas inside, across the border and outside the world
+        const std::vector<ViewPort> areas = {
+            ViewPort(-30.0f, -30.0f, 30.0f, 30.0f),
+            ViewPort(100.0f, -250.0f, 140.0f, -200.0f),
+            ViewPort(200.0f, 200.0f, 400.0f, 400.0f),
+            ViewPort(300.0f, 300.0f, 400.0f, 400.0f),
+            fixture.viewport};
+
+        for (const auto &area : areas)
+        {
+            RecordingRenderer renderer;
+            fixture.foodManager->render(renderer, area);
+
+            std::vector<Point> expected;
+            for (const auto &piece : food)
+            {
+                if (area.overlapsCircle(piece.getPosition(), piece.getSize()))
+                    expected.push_back(piece.getPosition());
+            }
+
+            // One circle per piece, in the order of the dense array
+            REQUIRE(renderer.circles.size() == expected.size());
+            for (std::size_t i = 0; i < expected.size(); i++)
+            {
+                REQUIRE(renderer.circles[i].position.x == expected[i].x);
+                REQUIRE(renderer.circles[i].position.y == expected[i].y);
+            }
+        }
+    }
 }
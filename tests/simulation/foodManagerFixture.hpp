@@ -40,7 +40,7 @@ namespace AntColony::Test::Simulation
                 viewport);
         }
 
-        const std::vector<std::shared_ptr<Food>> runUpdateForFrames(const int frames)
+        const std::vector<Food> runUpdateForFrames(const int frames)
         {
             for (int i = 0; i < frames; ++i)
             {
@@ -52,16 +52,16 @@ namespace AntColony::Test::Simulation
 
         const int runUpdateForFramesAndRemove(const int frames)
         {
-            const auto &foodParticles = runUpdateForFrames(frames);
+            const auto foodParticles = runUpdateForFrames(frames);
 
-            for (auto piece : foodParticles)
+            for (std::size_t i = 0; i < foodParticles.size(); i++)
             {
-                do
-                {
-                    piece->take();
-                } while ((piece->getCapacity() > 0));
+                const auto handle = foodManager->getHandle(i);
+                while (foodManager->take(handle).getCapacity() > 0)
+                    ;
             }
 
+            foodManager->removeDepleted();
             return foodManager->getFoodParticles().size();
         }
 
@@ -0,0 +1,227 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stack>
+#include <tuple>
+
+#include "../../src/simulation/pheromoneManager.hpp"
+#include "../../src/simulation/food.hpp"
+#include "../../src/core/point.hpp"
+#include "../../src/core/viewPort.hpp"
+#include "../fakeLogger.hpp"
+
+using namespace AntColony::Simulation;
+using namespace AntColony::Core;
+
+namespace AntColony::Test::Simulation
+{
+    namespace
+    {
+        constexpr auto PHEROMONE_SIZE = 0.01f;
+        constexpr auto TRAIL_COUNT = 3;
+        // Ants read the food capacity after their bite, so a full spot gives one less
+        constexpr auto MAX_EXCITEMENT = MAX_FOOD_CAPACITY - 1;
+
+        PheromoneManager createManager(bool isCoalescing)
+        {
+            PheromoneManager manager(std::make_shared<FakeLogger>(), PHEROMONE_SIZE, ViewPort(-1.0f, -1.0f, 1.0f, 1.0f));
+            manager.setCoalescing(isCoalescing);
+            return manager;
+        }
+
+        // Strength-weighted mean distance from the origin of the pheromones on each trail
+        std::vector<float> getTrailCentroids(const std::vector<PheromoneSignal> &pheromones)
+        {
+            std::vector<float> weighted(TRAIL_COUNT, 0.0f);
+            std::vector<float> strengths(TRAIL_COUNT, 0.0f);
+
+            for (const auto &pheromone : pheromones)
+            {
+                const auto angle = std::atan2(pheromone.position.y, pheromone.position.x) + 2 * M_PI;
+                const auto trail = static_cast<int>(std::lround(angle / (2 * M_PI / TRAIL_COUNT))) % TRAIL_COUNT;
+                weighted[trail] += pheromone.position.distanceTo(Point(0.0f, 0.0f)) * pheromone.excitement;
+                strengths[trail] += pheromone.excitement;
+            }
+
+            for (auto i = 0; i < TRAIL_COUNT; i++)
+                weighted[i] /= strengths[i];
+            return weighted;
+        }
+    }
+
+    TEST_CASE("PheromoneManager merges deposits in the same cell up to a cap", "[pheromonemanager]")
+    {
+        auto manager = createManager(true);
+
+        for (auto i = 0; i < 10; i++)
+        {
+            std::stack<PheromoneSignal> signals;
+            signals.emplace(Point(0.1f + i * 0.0001f, 0.1f), 1);
+            manager.update(signals);
+        }
+
+        auto pheromones = manager.getPheromones();
+        REQUIRE(pheromones.size() == 1);
+        REQUIRE(pheromones[0].position.x == 0.1f);
+        // Ten deposits of 50 with evaporation in between, clamped to the strongest single deposit
+        REQUIRE(pheromones[0].excitement == 100);
+        REQUIRE(manager.getMaxStrength() == 100);
+
+        std::stack<PheromoneSignal> farAway;
+        farAway.emplace(Point(-0.5f, -0.5f), 1);
+        manager.update(farAway);
+        REQUIRE(manager.getPheromones().size() == 2);
+
+        for (auto i = 0; i < 99; i++)
+            manager.update({});
+        REQUIRE(manager.getPheromones().empty());
+        REQUIRE(manager.getMaxStrength() == 0);
+    }
+
+    TEST_CASE("PheromoneManager coalescing keeps trails while tracking their length", "[pheromonemanager]")
+    {
+        auto plain = createManager(false);
+        auto coalesced = createManager(true);
+
+        // Ants walking on trails out of the origin, busier trails get more deposits
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> along(0.1f, 0.9f);
+        std::uniform_real_distribution<float> across(-0.01f, 0.01f);
+        std::uniform_int_distribution<int> excitement(1, MAX_EXCITEMENT);
+
+        for (auto tick = 0; tick < 500; tick++)
+        {
+            std::stack<PheromoneSignal> signals;
+            for (auto trail = 0; trail < TRAIL_COUNT; trail++)
+            {
+                const auto angle = trail * 2 * M_PI / TRAIL_COUNT;
+                for (auto deposit = 0; deposit <= trail; deposit++)
+                {
+                    const auto distance = along(random);
+                    const auto offset = across(random);
+                    signals.emplace(Point(std::cos(angle) * distance - std::sin(angle) * offset,
+                                          std::sin(angle) * distance + std::cos(angle) * offset),
+                                    excitement(random));
+                }
+            }
+
+            plain.update(signals);
+            coalesced.update(signals);
+        }
+
+        const auto plainPheromones = plain.getPheromones();
+        const auto coalescedPheromones = coalesced.getPheromones();
+
+        // The population follows the trail length instead of the traffic
+        REQUIRE(coalescedPheromones.size() * 4 < plainPheromones.size());
+
+        // Wherever a deposit is still alive there is a merged pheromone within a cell diagonal
+        for (const auto &pheromone : plainPheromones)
+        {
+            auto isCovered = false;
+            for (const auto &merged : coalescedPheromones)
+                isCovered = isCovered || pheromone.position.distanceTo(merged.position) < 0.06f;
+            REQUIRE(isCovered);
+        }
+
+        // Attraction along each trail is centred at the same place, within a tenth of the trail
+        const auto plainCentroids = getTrailCentroids(plainPheromones);
+        const auto coalescedCentroids = getTrailCentroids(coalescedPheromones);
+        for (auto trail = 0; trail < TRAIL_COUNT; trail++)
+            REQUIRE(std::abs(plainCentroids[trail] - coalescedCentroids[trail]) < 0.08f);
+    }
+
+    TEST_CASE("PheromoneManager evicts the weakest pheromones over the limit", "[pheromonemanager]")
+    {
+        constexpr std::size_t LIMIT = 64;
+
+        auto manager = createManager(false);
+        manager.setMaxPheromones(LIMIT);
+
+        // Reference keeping the strongest strengths by brute force
+        std::vector<int> expected;
+        std::uint64_t expectedEvictions = 0;
+
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> position(-0.9f, 0.9f);
+        std::uniform_int_distribution<int> excitement(1, MAX_EXCITEMENT);
+        std::uniform_int_distribution<int> depositCount(0, 4);
+
+        for (auto tick = 0; tick < 1000; tick++)
+        {
+            std::stack<PheromoneSignal> signals;
+            for (auto i = depositCount(random); i > 0; i--)
+                signals.emplace(Point(position(random), position(random)), excitement(random));
+
+            for (auto &strength : expected)
+                strength--;
+            expected.erase(std::remove(expected.begin(), expected.end(), 0), expected.end());
+
+            for (auto pending = signals; !pending.empty(); pending.pop())
+            {
+                const auto strength = pending.top().excitement * 50;
+                if (expected.size() >= LIMIT)
+                {
+                    expectedEvictions++;
+                    const auto weakest = std::min_element(expected.begin(), expected.end());
+                    if (*weakest >= strength)
+                        continue;
+                    expected.erase(weakest);
+                }
+                expected.push_back(strength);
+            }
+
+            manager.update(signals);
+
+            std::vector<int> strengths;
+            for (const auto &pheromone : manager.getPheromones())
+                strengths.push_back(pheromone.excitement);
+
+            std::sort(strengths.begin(), strengths.end());
+            std::sort(expected.begin(), expected.end());
+            REQUIRE(strengths.size() <= LIMIT);
+            REQUIRE(strengths == expected);
+            REQUIRE(manager.getMaxStrength() == (strengths.empty() ? 0 : strengths.back()));
+        }
+
+        REQUIRE(expectedEvictions > 0);
+        REQUIRE(manager.getEvictionCount() == expectedEvictions);
+    }
+
+    TEST_CASE("PheromoneManager keeps merging and decaying the same after Morton reorders", "[pheromonemanager]")
+    {
+        auto sorted = createManager(true);
+        auto unsorted = createManager(true);
+
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float> position(-0.9f, 0.9f);
+        std::uniform_int_distribution<int> excitement(1, MAX_EXCITEMENT);
+
+        const auto toTuples = [](const std::vector<PheromoneSignal> &pheromones)
+        {
+            std::vector<std::tuple<float, float, int>> tuples;
+            for (const auto &pheromone : pheromones)
+                tuples.emplace_back(pheromone.position.x, pheromone.position.y, pheromone.excitement);
+            std::sort(tuples.begin(), tuples.end());
+            return tuples;
+        };
+
+        for (auto tick = 0; tick < 600; tick++)
+        {
+            // Few places so deposits keep merging into pheromones the sorts moved
+            std::stack<PheromoneSignal> signals;
+            for (auto i = 0; i < 8; i++)
+                signals.emplace(Point(std::round(position(random) * 5.0f) / 5.0f, std::round(position(random) * 5.0f) / 5.0f), excitement(random));
+
+            sorted.update(signals);
+            unsorted.update(signals);
+
+            if (tick % 7 == 0)
+                sorted.sortByMorton(nullptr);
+
+            REQUIRE(toTuples(sorted.getPheromones()) == toTuples(unsorted.getPheromones()));
+            REQUIRE(sorted.getMaxStrength() == unsorted.getMaxStrength());
+        }
+    }
+}
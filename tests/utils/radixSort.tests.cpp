@@ -0,0 +1,40 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "../../src/utils/radixSort.hpp"
+#include "../../src/utils/workerPool.hpp"
+
+namespace AntColony::Test::Utils
+{
+    TEST_CASE("Radix sort orders keys like a stable sort", "[radixsort]")
+    {
+        AntColony::Utils::WorkerPool pool(4);
+        std::mt19937 random(3);
+
+        // Small inputs sort on the calling thread, large ones in chunks, few distinct keys check stability
+        for (const auto count : {0u, 1u, 1000u, 100000u})
+        {
+            for (const auto maxKey : {0xffffffffu, 15u})
+            {
+                std::uniform_int_distribution<std::uint32_t> key(0, maxKey);
+                std::vector<std::uint32_t> keys(count);
+                for (auto &value : keys)
+                    value = key(random);
+
+                std::vector<std::uint32_t> expected(count);
+                std::iota(expected.begin(), expected.end(), 0);
+                std::stable_sort(expected.begin(), expected.end(), [&](std::uint32_t a, std::uint32_t b)
+                                 { return keys[a] < keys[b]; });
+
+                std::vector<std::uint32_t> order;
+                AntColony::Utils::radixSortOrder(keys, order, &pool);
+                REQUIRE(order == expected);
+
+                AntColony::Utils::radixSortOrder(keys, order, nullptr);
+                REQUIRE(order == expected);
+            }
+        }
+    }
+}
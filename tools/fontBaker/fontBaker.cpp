@@ -0,0 +1,243 @@
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_truetype.h>
+#include <dejavu_fonts.hpp>
+
+#include "../../src/render/text/fontAtlas.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Build-time tool that rasterises the main font into a signed distance field atlas
+ * and writes it, together with glyph metrics, as a C++ source containing a byte blob.
+ *
+ * Usage: AntColonyFontBaker <output.cpp>
+ */
+namespace AntColony::Tools::FontBaker
+{
+    using Render::Text::BakedGlyph;
+    using Render::Text::FontAtlasHeader;
+
+    // ASCII
+    constexpr const auto TAB_CHAR = 9;
+    constexpr const auto LINE_FEED_CHAR = 10;
+    constexpr const auto RETURN_CHAR = 13;
+    constexpr const auto SPACE_CHAR = 32;
+
+    constexpr const auto TAB_SIZE = 4;
+    constexpr const auto MAX_ACII_CODE = 128;
+
+    // TEXTURE
+    constexpr const auto TEXTURE_SIZE = 512;
+
+    // SDF
+    constexpr const auto SDF_BASE_FONT_SIZE = 32.0f;
+    constexpr const auto SDF_PADDING = 4;
+    constexpr const unsigned char SDF_ON_EDGE_VALUE = 128;
+    constexpr const auto SDF_PIXEL_DIST_SCALE = static_cast<float>(SDF_ON_EDGE_VALUE) / SDF_PADDING;
+
+    // OUTPUT
+    constexpr const auto BYTES_PER_LINE = 16;
+
+    struct BakedFont
+    {
+        FontAtlasHeader header{};
+        std::vector<BakedGlyph> glyphs;
+        std::vector<unsigned char> bitmap;
+    };
+
+    void bakeSpecialCharacterGlyphs(const stbtt_fontinfo &info, BakedFont &font)
+    {
+        int spaceAdvance = 0;
+        for (int c : {SPACE_CHAR, TAB_CHAR, LINE_FEED_CHAR, RETURN_CHAR})
+        {
+            BakedGlyph glyph{};
+            glyph.codepoint = c;
+            stbtt_GetCodepointHMetrics(&info, c, &glyph.advance, &glyph.lsb);
+
+            if (c == SPACE_CHAR)
+            {
+                if (glyph.advance <= 0)
+                {
+                    std::cerr << "Invalid advance for space, using default: " << glyph.advance << std::endl;
+                    glyph.advance = static_cast<int>(font.header.size / 4.0f / font.header.scale);
+                }
+                spaceAdvance = glyph.advance;
+            }
+            else if (c == TAB_CHAR)
+            {
+                glyph.advance = spaceAdvance * TAB_SIZE;
+            }
+            else
+            {
+                glyph.advance = 0;
+            }
+
+            font.glyphs.push_back(glyph);
+        }
+    }
+
+    bool bakeRegularCharacterGlyphs(const stbtt_fontinfo &info, BakedFont &font)
+    {
+        int pos_x = 0, pos_y = 0, max_height = 0;
+
+        for (auto c = SPACE_CHAR + 1; c < MAX_ACII_CODE; c++)
+        {
+            BakedGlyph glyph{};
+            glyph.codepoint = c;
+            stbtt_GetCodepointHMetrics(&info, c, &glyph.advance, &glyph.lsb);
+
+            if (glyph.advance <= 0)
+            {
+                std::cerr << "Invalid advance for char '" << static_cast<char>(c) << "', using default" << std::endl;
+                glyph.advance = static_cast<int>(font.header.size / 2.0f / font.header.scale);
+            }
+
+            // Distance field includes padding around the glyph, offsets account for it
+            int w = 0, h = 0;
+            auto *glyph_bitmap = stbtt_GetCodepointSDF(
+                &info, font.header.scale, c, SDF_PADDING, SDF_ON_EDGE_VALUE, SDF_PIXEL_DIST_SCALE,
+                &w, &h, &glyph.x0, &glyph.y0);
+            if (!glyph_bitmap || w <= 0 || h <= 0)
+            {
+                std::cerr << "Failed to generate glyph bitmap for character: " << c << std::endl;
+                stbtt_FreeSDF(glyph_bitmap, nullptr);
+                continue;
+            }
+            glyph.x1 = glyph.x0 + w;
+            glyph.y1 = glyph.y0 + h;
+
+            if (pos_x + w > TEXTURE_SIZE)
+            {
+                pos_x = 0;
+                pos_y += max_height + 1;
+                max_height = 0;
+            }
+            if (pos_y + h > TEXTURE_SIZE)
+            {
+                std::cerr << "Font atlas is full at character: " << c << std::endl;
+                stbtt_FreeSDF(glyph_bitmap, nullptr);
+                return false;
+            }
+
+            for (int j = 0; j < h; j++)
+            {
+                std::memcpy(&font.bitmap[(pos_y + j) * TEXTURE_SIZE + pos_x], &glyph_bitmap[j * w], w);
+            }
+            stbtt_FreeSDF(glyph_bitmap, nullptr);
+
+            glyph.tex_x = pos_x;
+            glyph.tex_y = pos_y;
+            font.glyphs.push_back(glyph);
+            pos_x += w + 1;
+            max_height = std::max(max_height, h);
+        }
+
+        // Drop unused rows to keep the blob compact
+        font.header.height = pos_y + max_height;
+        font.bitmap.resize(static_cast<size_t>(font.header.width) * font.header.height);
+        return true;
+    }
+
+    bool bakeFont(const unsigned char *fontData, BakedFont &font)
+    {
+        stbtt_fontinfo info;
+        if (!stbtt_InitFont(&info, fontData, 0))
+        {
+            std::cerr << "Failed to initialize font: Invalid font data" << std::endl;
+            return false;
+        }
+
+        auto &header = font.header;
+        header.magic = Render::Text::FONT_ATLAS_MAGIC;
+        header.version = Render::Text::FONT_ATLAS_VERSION;
+        header.size = SDF_BASE_FONT_SIZE;
+        header.scale = stbtt_ScaleForPixelHeight(&info, SDF_BASE_FONT_SIZE);
+        stbtt_GetFontVMetrics(&info, &header.ascent, &header.descent, &header.lineGap);
+        header.lineHeight = (header.ascent - header.descent + header.lineGap) * header.scale;
+        header.width = TEXTURE_SIZE;
+        header.height = TEXTURE_SIZE;
+        header.sdf = 1;
+
+        font.bitmap.assign(static_cast<size_t>(TEXTURE_SIZE) * TEXTURE_SIZE, 0);
+
+        bakeSpecialCharacterGlyphs(info, font);
+        if (!bakeRegularCharacterGlyphs(info, font))
+            return false;
+
+        header.glyphCount = static_cast<std::uint32_t>(font.glyphs.size());
+        return true;
+    }
+
+    std::vector<unsigned char> serialize(const BakedFont &font)
+    {
+        std::vector<unsigned char> blob(sizeof(FontAtlasHeader) + font.glyphs.size() * sizeof(BakedGlyph) + font.bitmap.size());
+        auto *out = blob.data();
+
+        std::memcpy(out, &font.header, sizeof(FontAtlasHeader));
+        out += sizeof(FontAtlasHeader);
+        std::memcpy(out, font.glyphs.data(), font.glyphs.size() * sizeof(BakedGlyph));
+        out += font.glyphs.size() * sizeof(BakedGlyph);
+        std::memcpy(out, font.bitmap.data(), font.bitmap.size());
+
+        return blob;
+    }
+
+    bool writeSource(const std::string &path, const std::vector<unsigned char> &blob)
+    {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file)
+        {
+            std::cerr << "Failed to open file: " << path << std::endl;
+            return false;
+        }
+
+        file << "// Generated by AntColonyFontBaker, do not edit.\n";
+        file << "#include <cstddef>\n\n";
+        file << "extern const unsigned char MAIN_FONT_ATLAS[];\n";
+        file << "extern const std::size_t MAIN_FONT_ATLAS_LEN;\n\n";
+        file << "alignas(4) const unsigned char MAIN_FONT_ATLAS[] = {";
+
+        char hex[8];
+        for (size_t i = 0; i < blob.size(); i++)
+        {
+            if (i % BYTES_PER_LINE == 0)
+                file << "\n   ";
+            std::snprintf(hex, sizeof(hex), " 0x%02x,", blob[i]);
+            file << hex;
+        }
+
+        file << "\n};\n\n";
+        file << "const std::size_t MAIN_FONT_ATLAS_LEN = " << blob.size() << ";\n";
+
+        return static_cast<bool>(file);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    using namespace AntColony::Tools::FontBaker;
+
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output.cpp>" << std::endl;
+        return 1;
+    }
+
+    BakedFont font;
+    if (!bakeFont(DEJAVU_SANS_MONO_TTF, font))
+        return 1;
+
+    const auto blob = serialize(font);
+    if (!writeSource(argv[1], blob))
+        return 1;
+
+    std::cout << "Baked " << font.glyphs.size() << " glyphs into " << font.header.width << "x" << font.header.height
+              << " atlas (" << blob.size() << " bytes)" << std::endl;
+    return 0;
+}
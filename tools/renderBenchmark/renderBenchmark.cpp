@@ -0,0 +1,166 @@
+#include "sceneRecorder.hpp"
+
+#include "../../src/render/render.hpp"
+#include "../../src/utils/consoleLogger.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Replays a recorded simulation scene through a render engine as fast as possible and reports
+ * draw calls, state changes, uploaded bytes and submit and frame times. OpenGL runs in an offscreen context so the
+ * benchmark works without a display, on Mesa's llvmpipe when there is no GPU.
+ *
+ * Usage: AntColonyRenderBenchmark [--engine=<opengl|software>] [--frames=<count>] [--iterations=<count>] [--size=<pixels>] [--circles=<quad|fan>] [--heatmap]
+ */
+namespace AntColony::Tools::RenderBenchmark
+{
+    constexpr const std::string_view ENGINE_OPTION = "--engine=";
+    constexpr const std::string_view FRAMES_OPTION = "--frames=";
+    constexpr const std::string_view ITERATIONS_OPTION = "--iterations=";
+    constexpr const std::string_view SIZE_OPTION = "--size=";
+    constexpr const std::string_view CIRCLES_OPTION = "--circles=";
+
+    constexpr const int DEFAULT_FRAMES = 300;
+    constexpr const int DEFAULT_ITERATIONS = 5;
+
+    struct Options
+    {
+        Render::RENDER_ENGINE engine = Render::OPENGL;
+        int frames = DEFAULT_FRAMES;
+        int iterations = DEFAULT_ITERATIONS;
+        int size = Render::DEFAULT_FRAME_SIZE;
+        Render::CIRCLE_RENDER_MODE circleMode = Render::SDF_QUAD;
+        Simulation::PHEROMONE_RENDER_MODE pheromoneRenderMode = Simulation::CIRCLES;
+    };
+
+    bool tryParseValue(const std::string &arg, std::string_view option, int &value)
+    {
+        if (arg.rfind(option, 0) != 0)
+            return false;
+
+        value = std::atoi(arg.c_str() + option.size());
+        return value > 0;
+    }
+
+    bool tryParseOptions(int argc, char **argv, Options &options, Core::Logger &logger)
+    {
+        for (auto i = 1; i < argc; i++)
+        {
+            const std::string arg = argv[i];
+
+            if (arg == std::string(ENGINE_OPTION) + "opengl")
+                options.engine = Render::OPENGL;
+            else if (arg == std::string(ENGINE_OPTION) + "software")
+                options.engine = Render::SOFTWARE;
+            else if (tryParseValue(arg, FRAMES_OPTION, options.frames) ||
+                     tryParseValue(arg, ITERATIONS_OPTION, options.iterations) ||
+                     tryParseValue(arg, SIZE_OPTION, options.size))
+                continue;
+            else if (arg.rfind(CIRCLES_OPTION, 0) == 0)
+            {
+                if (!Render::tryParseCircleRenderMode(std::string_view(arg).substr(CIRCLES_OPTION.size()), options.circleMode))
+                {
+                    logger.error("Unknown circle render mode: " + arg.substr(CIRCLES_OPTION.size()) + ", expected quad or fan");
+                    return false;
+                }
+            }
+            else if (arg == "--heatmap")
+                options.pheromoneRenderMode = Simulation::HEATMAP;
+            else
+            {
+                logger.error("Unknown option: " + arg);
+                logger.info("Options: --engine=<opengl|software>, --frames=<count>, --iterations=<count>, --size=<pixels>, --circles=<quad|fan>, --heatmap");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void report(const std::vector<Render::RenderStats> &stats, Core::Logger &logger)
+    {
+        std::vector<float> frameTimes;
+        frameTimes.reserve(stats.size());
+
+        double drawCalls = 0.0;
+        double stateChanges = 0.0;
+        double uploadedBytes = 0.0;
+        double submitTime = 0.0;
+        double totalTime = 0.0;
+        for (const auto &frame : stats)
+        {
+            drawCalls += frame.drawCalls;
+            stateChanges += frame.programBinds + frame.vertexArrayBinds + frame.textureBinds + frame.uniformUploads;
+            uploadedBytes += static_cast<double>(frame.uploadedBytes);
+            submitTime += frame.submitTime;
+            totalTime += frame.frameTime;
+            frameTimes.push_back(frame.frameTime);
+        }
+
+        std::sort(frameTimes.begin(), frameTimes.end());
+        const auto percentile = [&frameTimes](float p)
+        {
+            const auto index = static_cast<size_t>(p * static_cast<float>(frameTimes.size() - 1));
+            return frameTimes[index];
+        };
+
+        const auto count = static_cast<double>(stats.size());
+        char message[256];
+        std::snprintf(message, sizeof(message),
+                      "Frames: %zu, draw calls/frame: %.1f, state changes/frame: %.1f, uploaded KiB/frame: %.1f, submit ms/frame: %.3f, "
+                      "FPS: %.1f, frame time ms p50: %.3f, p95: %.3f, max: %.3f",
+                      stats.size(), drawCalls / count, stateChanges / count, uploadedBytes / count / 1024.0, submitTime / count,
+                      count * 1000.0 / totalTime, percentile(0.50f), percentile(0.95f), frameTimes.back());
+        logger.info(message);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    using namespace AntColony::Tools::RenderBenchmark;
+
+    std::shared_ptr<AntColony::Core::Logger> logger = std::make_shared<AntColony::Utils::ConsoleLogger>();
+
+    Options options;
+    if (!tryParseOptions(argc, argv, options, *logger))
+        return -1;
+
+    const auto scene = recordScene(options.frames, options.size, options.pheromoneRenderMode, logger);
+    logger->info("Recorded " + std::to_string(scene.size()) + " frames");
+
+    AntColony::Render::RenderSettings settings;
+    settings.pacing = AntColony::Render::UNCAPPED;
+    settings.width = settings.height = options.size;
+    settings.offscreen = true;
+    settings.circleMode = options.circleMode;
+
+    auto renderCtx = AntColony::Render::initRenderContext(options.engine, logger, settings);
+    if (!renderCtx->getInited())
+        return -1;
+
+    std::vector<AntColony::Render::RenderStats> stats;
+    stats.reserve(scene.size());
+
+    for (auto iteration = 0; iteration < options.iterations; iteration++)
+    {
+        stats.clear();
+        for (const auto &frame : scene)
+        {
+            auto &frameCtx = renderCtx->beginFrame();
+            replayFrame(frame, frameCtx.getRenderer());
+            renderCtx->endFrame();
+            stats.push_back(frameCtx.getStats());
+        }
+
+        logger->info("Iteration " + std::to_string(iteration + 1) + "/" + std::to_string(options.iterations));
+        report(stats, *logger);
+    }
+
+    return 0;
+}
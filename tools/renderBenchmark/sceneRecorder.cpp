@@ -0,0 +1,132 @@
+#include "sceneRecorder.hpp"
+
+#include "../../src/core/color.hpp"
+#include "../../src/core/point.hpp"
+#include "../../src/simulation/simulation.hpp"
+#include "../../src/utils/randomGenerator.hpp"
+
+namespace AntColony::Tools::RenderBenchmark
+{
+    // Fixed so every run records the same scene
+    constexpr const unsigned int SCENE_SEED = 1;
+
+    SceneRecorder::SceneRecorder(int width, int height)
+    {
+        camera.setViewportSize(width, height);
+    }
+
+    void SceneRecorder::beginFrame()
+    {
+        frames.emplace_back();
+    }
+
+    const std::vector<RecordedFrame> &SceneRecorder::getFrames() const { return frames; }
+
+    void SceneRecorder::drawCircleInPosition(const Core::Point &position, const float radius, const Core::Color &color)
+    {
+        auto &frame = frames.back();
+        frame.commands.push_back({RecordedFrame::CIRCLE, 0, position.x, position.y, color.r, color.g, color.b, radius});
+    }
+
+    void SceneRecorder::drawText(const Core::Point &position, const std::string &text, const Core::Color &color, const float fontSize)
+    {
+        auto &frame = frames.back();
+        frame.texts.push_back(text);
+        frame.commands.push_back({RecordedFrame::TEXT, frame.texts.size() - 1, position.x, position.y, color.r, color.g, color.b, fontSize});
+    }
+
+    void SceneRecorder::drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        auto &frame = frames.back();
+        frame.densityGrids.push_back(grid);
+        frame.commands.push_back({RecordedFrame::DENSITY, frame.densityGrids.size() - 1, 0.0f, 0.0f, color.r, color.g, color.b, 0.0f});
+    }
+
+    void SceneRecorder::drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color)
+    {
+        auto &frame = frames.back();
+        frame.densityGrids.push_back(grid);
+        frame.commands.push_back({RecordedFrame::COVERAGE, frame.densityGrids.size() - 1, 0.0f, 0.0f, color.r, color.g, color.b, 0.0f});
+    }
+
+    bool SceneRecorder::beginStaticLayer() { return true; }
+
+    void SceneRecorder::endStaticLayer()
+    {
+        auto &frame = frames.back();
+        frame.usesStaticLayer = true;
+        frame.staticCommandCount = frame.commands.size();
+    }
+
+    void SceneRecorder::invalidateStaticLayer() {}
+
+    Render::Renderer &SceneRecorder::getRenderer() const
+    {
+        // Simulation only draws through the frame context, which is this recorder
+        return const_cast<SceneRecorder &>(*this);
+    }
+
+    const Render::RenderStats &SceneRecorder::getStats() const { return stats; }
+    const Render::Camera &SceneRecorder::getCamera() const { return camera; }
+
+    namespace
+    {
+        void replayCommands(const RecordedFrame &frame, std::size_t first, std::size_t last, Render::Renderer &renderer)
+        {
+            for (auto i = first; i < last; i++)
+            {
+                const auto &command = frame.commands[i];
+                const Core::Color color(command.r, command.g, command.b);
+
+                switch (command.type)
+                {
+                case RecordedFrame::CIRCLE:
+                    renderer.drawCircleInPosition(Core::Point(command.x, command.y), command.size, color);
+                    break;
+                case RecordedFrame::TEXT:
+                    renderer.drawText(Core::Point(command.x, command.y), frame.texts[command.index], color, command.size);
+                    break;
+                case RecordedFrame::DENSITY:
+                    renderer.drawDensityGrid(frame.densityGrids[command.index], color);
+                    break;
+                case RecordedFrame::COVERAGE:
+                    renderer.drawCoverageGrid(frame.densityGrids[command.index], color);
+                    break;
+                }
+            }
+        }
+    }
+
+    void replayFrame(const RecordedFrame &frame, Render::Renderer &renderer)
+    {
+        // Same order as Simulation::render, so engines only redraw the layer when it is invalid
+        std::size_t first = 0;
+        if (frame.usesStaticLayer)
+        {
+            if (renderer.beginStaticLayer())
+                replayCommands(frame, 0, frame.staticCommandCount, renderer);
+            renderer.endStaticLayer();
+            first = frame.staticCommandCount;
+        }
+
+        replayCommands(frame, first, frame.commands.size(), renderer);
+    }
+
+    std::vector<RecordedFrame> recordScene(int frameCount, int size, Simulation::PHEROMONE_RENDER_MODE pheromoneRenderMode, std::shared_ptr<Core::Logger> logger)
+    {
+        Utils::RandomGenerator::getInstance().seed(SCENE_SEED);
+
+        Simulation::Simulation simulation(logger);
+        simulation.setPheromoneRenderMode(pheromoneRenderMode);
+
+        SceneRecorder recorder(size, size);
+        for (auto i = 0; i < frameCount; i++)
+        {
+            recorder.beginFrame();
+            simulation.update(recorder);
+            simulation.render(recorder);
+        }
+
+        return recorder.getFrames();
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../../src/core/densityGrid.hpp"
+#include "../../src/render/camera.hpp"
+#include "../../src/render/frameContext.hpp"
+#include "../../src/render/renderer.hpp"
+#include "../../src/render/renderStats.hpp"
+#include "../../src/simulation/pheromoneRenderMode.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AntColony::Tools::RenderBenchmark
+{
+    /**
+     * @brief Draw calls of one simulation frame, in submission order.
+     */
+    struct RecordedFrame
+    {
+        enum COMMAND_TYPE
+        {
+            CIRCLE,
+            TEXT,
+            DENSITY,
+            COVERAGE,
+        };
+
+        struct Command
+        {
+            COMMAND_TYPE type;
+            /// @brief Index into the list matching the type.
+            std::size_t index;
+            float x, y;
+            float r, g, b;
+            /// @brief Circle radius or font size.
+            float size;
+        };
+
+        std::vector<Command> commands;
+        /// @brief Whether the first staticCommandCount commands form the static layer.
+        bool usesStaticLayer = false;
+        std::size_t staticCommandCount = 0;
+        std::vector<std::string> texts;
+        /// @brief Density and coverage grids.
+        std::vector<Core::DensityGrid> densityGrids;
+    };
+
+    /**
+     * @brief Renderer that stores draw calls so a scene can be replayed through any render engine.
+     */
+    class SceneRecorder : public Render::Renderer, public Render::FrameContext
+    {
+    public:
+        /**
+         * @brief Constructor with the size of the replay target, levels of detail are picked for it.
+         * @param width Target width in pixels.
+         * @param height Target height in pixels.
+         */
+        SceneRecorder(int width, int height);
+
+        /**
+         * @brief Starts a new frame, following draw calls are stored into it.
+         */
+        void beginFrame();
+
+        const std::vector<RecordedFrame> &getFrames() const;
+
+        // Renderer
+        void drawCircleInPosition(const Core::Point &position, const float radius, const Core::Color &color) override;
+        void drawText(const Core::Point &position, const std::string &text, const Core::Color &color, const float fontSize) override;
+        void drawDensityGrid(const Core::DensityGrid &grid, const Core::Color &color) override;
+        void drawCoverageGrid(const Core::DensityGrid &grid, const Core::Color &color) override;
+
+        /**
+         * @brief Always records the static layer, replays decide whether to draw it.
+         */
+        bool beginStaticLayer() override;
+        void endStaticLayer() override;
+        void invalidateStaticLayer() override;
+
+        // FrameContext
+        Render::Renderer &getRenderer() const override;
+        const Render::RenderStats &getStats() const override;
+        const Render::Camera &getCamera() const override;
+
+    private:
+        std::vector<RecordedFrame> frames;
+        /// @brief Recording does not render, stays empty.
+        Render::RenderStats stats;
+        /// @brief Identity view, nothing is culled while recording.
+        Render::Camera camera;
+    };
+
+    /**
+     * @brief Issues the draw calls of a recorded frame to a renderer.
+     */
+    void replayFrame(const RecordedFrame &frame, Render::Renderer &renderer);
+
+    /**
+     * @brief Runs the simulation headless from a fixed seed and stores what it draws, so every run records the same scene.
+     * @param frameCount Number of frames to record.
+     * @param size Width and height of the replay target in pixels.
+     * @param pheromoneRenderMode How the simulation draws pheromones.
+     * @param logger Shared pointer to the logger instance.
+     */
+    std::vector<RecordedFrame> recordScene(int frameCount, int size, Simulation::PHEROMONE_RENDER_MODE pheromoneRenderMode, std::shared_ptr<Core::Logger> logger);
+}
@@ -0,0 +1,223 @@
+#include "../renderBenchmark/sceneRecorder.hpp"
+
+#include "../../src/render/render.hpp"
+#include "../../src/utils/consoleLogger.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Replays a recorded simulation scene through the software rasteriser and offscreen OpenGL, captures both as
+ * PPM frames and checks that they match within a per-pixel tolerance. Frames the GL capture dropped are skipped.
+ *
+ * Usage: AntColonyRenderParity [--frames=<count>] [--size=<pixels>] [--tolerance=<levels>] [--max-mismatch=<percent>] [--heatmap]
+ */
+namespace AntColony::Tools::RenderParity
+{
+    constexpr const std::string_view FRAMES_OPTION = "--frames=";
+    constexpr const std::string_view SIZE_OPTION = "--size=";
+    constexpr const std::string_view TOLERANCE_OPTION = "--tolerance=";
+    constexpr const std::string_view MAX_MISMATCH_OPTION = "--max-mismatch=";
+
+    constexpr const int DEFAULT_FRAMES = 60;
+    constexpr const int DEFAULT_SIZE = 256;
+    // Channel difference allowed per pixel, covers edge anti-aliasing and blending rounding
+    constexpr const int DEFAULT_TOLERANCE = 32;
+    // Share of pixels in percent allowed over the tolerance per frame
+    constexpr const float DEFAULT_MAX_MISMATCH = 1.0f;
+
+    constexpr const char *OUTPUT_DIRECTORY = "AntColonyRenderParity";
+
+    struct Options
+    {
+        int frames = DEFAULT_FRAMES;
+        int size = DEFAULT_SIZE;
+        int tolerance = DEFAULT_TOLERANCE;
+        float maxMismatch = DEFAULT_MAX_MISMATCH;
+        Simulation::PHEROMONE_RENDER_MODE pheromoneRenderMode = Simulation::CIRCLES;
+    };
+
+    bool tryParseValue(const std::string &arg, std::string_view option, float &value)
+    {
+        if (arg.rfind(option, 0) != 0)
+            return false;
+
+        value = std::strtof(arg.c_str() + option.size(), nullptr);
+        return value >= 0.0f;
+    }
+
+    bool tryParseOptions(int argc, char **argv, Options &options, Core::Logger &logger)
+    {
+        for (auto i = 1; i < argc; i++)
+        {
+            const std::string arg = argv[i];
+            auto value = 0.0f;
+
+            if (tryParseValue(arg, FRAMES_OPTION, value) && value > 0.0f)
+                options.frames = static_cast<int>(value);
+            else if (tryParseValue(arg, SIZE_OPTION, value) && value > 0.0f)
+                options.size = static_cast<int>(value);
+            else if (tryParseValue(arg, TOLERANCE_OPTION, value))
+                options.tolerance = static_cast<int>(value);
+            else if (tryParseValue(arg, MAX_MISMATCH_OPTION, value))
+                options.maxMismatch = value;
+            else if (arg == "--heatmap")
+                options.pheromoneRenderMode = Simulation::HEATMAP;
+            else
+            {
+                logger.error("Unknown option: " + arg);
+                logger.info("Options: --frames=<count>, --size=<pixels>, --tolerance=<levels>, --max-mismatch=<percent>, --heatmap");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Replays the scene through an engine and writes every frame as PPM into the directory.
+     */
+    bool renderScene(Render::RENDER_ENGINE engine, const std::vector<RenderBenchmark::RecordedFrame> &scene, int size,
+                     const std::filesystem::path &directory, std::shared_ptr<Core::Logger> logger)
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+
+        Render::RenderSettings settings;
+        settings.pacing = Render::UNCAPPED;
+        settings.width = settings.height = size;
+        settings.offscreen = true;
+        settings.captureFormat = Render::Capture::PPM;
+        settings.capturePath = directory.string();
+        // A slot per frame so the writer never drops one
+        settings.captureQueueSize = static_cast<unsigned int>(scene.size());
+
+        // Destroying the context flushes the capture
+        auto renderCtx = Render::initRenderContext(engine, logger, settings);
+        if (!renderCtx->getInited())
+            return false;
+
+        for (const auto &frame : scene)
+        {
+            auto &frameCtx = renderCtx->beginFrame();
+            RenderBenchmark::replayFrame(frame, frameCtx.getRenderer());
+            renderCtx->endFrame();
+        }
+
+        return true;
+    }
+
+    bool readPpm(const std::filesystem::path &path, int size, std::vector<std::uint8_t> &pixels)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        std::string magic;
+        auto width = 0;
+        auto height = 0;
+        auto maxValue = 0;
+        file >> magic >> width >> height >> maxValue;
+        file.get();
+
+        if (!file || magic != "P6" || width != size || height != size || maxValue != 255)
+            return false;
+
+        pixels.resize(static_cast<std::size_t>(width) * height * 3);
+        file.read(reinterpret_cast<char *>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+        return static_cast<bool>(file);
+    }
+
+    /**
+     * @brief Compares the frames both engines captured.
+     * @return Number of frames over the mismatch limit, or -1 if no frame could be compared.
+     */
+    int compareScenes(const std::filesystem::path &softwareDirectory, const std::filesystem::path &glDirectory, std::size_t frameCount,
+                      const Options &options, Core::Logger &logger)
+    {
+        std::vector<std::uint8_t> softwarePixels;
+        std::vector<std::uint8_t> glPixels;
+        auto comparedFrames = 0;
+        auto failedFrames = 0;
+        auto worstMismatch = 0.0f;
+
+        for (std::size_t i = 0; i < frameCount; i++)
+        {
+            char fileName[32];
+            std::snprintf(fileName, sizeof(fileName), "frame_%06zu.ppm", i);
+
+            if (!readPpm(softwareDirectory / fileName, options.size, softwarePixels) || !readPpm(glDirectory / fileName, options.size, glPixels))
+                continue;
+
+            std::size_t mismatchedPixels = 0;
+            auto maxDifference = 0;
+            for (std::size_t pixel = 0; pixel < softwarePixels.size(); pixel += 3)
+            {
+                auto difference = 0;
+                for (auto channel = 0; channel < 3; channel++)
+                    difference = std::max(difference, std::abs(softwarePixels[pixel + channel] - glPixels[pixel + channel]));
+
+                maxDifference = std::max(maxDifference, difference);
+                if (difference > options.tolerance)
+                    mismatchedPixels++;
+            }
+
+            const auto mismatch = 100.0f * static_cast<float>(mismatchedPixels) / static_cast<float>(softwarePixels.size() / 3);
+            worstMismatch = std::max(worstMismatch, mismatch);
+            comparedFrames++;
+
+            if (mismatch > options.maxMismatch)
+            {
+                failedFrames++;
+
+                char message[160];
+                std::snprintf(message, sizeof(message), "Frame %zu: %.2f%% of pixels differ by more than %d, max difference %d",
+                              i, mismatch, options.tolerance, maxDifference);
+                logger.error(message);
+            }
+        }
+
+        if (comparedFrames == 0)
+        {
+            logger.error("No frame was captured by both engines");
+            return -1;
+        }
+
+        char message[160];
+        std::snprintf(message, sizeof(message), "Compared %d frames, %d over %.2f%% mismatched pixels, worst %.2f%%",
+                      comparedFrames, failedFrames, options.maxMismatch, worstMismatch);
+        logger.info(message);
+        return failedFrames;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    using namespace AntColony::Tools::RenderParity;
+
+    std::shared_ptr<AntColony::Core::Logger> logger = std::make_shared<AntColony::Utils::ConsoleLogger>();
+
+    Options options;
+    if (!tryParseOptions(argc, argv, options, *logger))
+        return -1;
+
+    const auto scene = AntColony::Tools::RenderBenchmark::recordScene(options.frames, options.size, options.pheromoneRenderMode, logger);
+    logger->info("Recorded " + std::to_string(scene.size()) + " frames");
+
+    const auto outputDirectory = std::filesystem::temp_directory_path() / OUTPUT_DIRECTORY;
+    const auto softwareDirectory = outputDirectory / "software";
+    const auto glDirectory = outputDirectory / "opengl";
+
+    if (!renderScene(AntColony::Render::SOFTWARE, scene, options.size, softwareDirectory, logger) ||
+        !renderScene(AntColony::Render::OPENGL, scene, options.size, glDirectory, logger))
+        return -1;
+
+    const auto failedFrames = compareScenes(softwareDirectory, glDirectory, scene.size(), options, *logger);
+    logger->info("Captured frames are kept in " + outputDirectory.string());
+    return failedFrames == 0 ? 0 : 1;
+}